@@ -59,17 +59,30 @@ namespace apachearrow {
             ss << "Failed to open RecordBatchFileReader: " << status.message() << std::endl;
             PSP_COMPLAIN_AND_ABORT(ss.str());
         } else {
-            std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
             auto num_batches = batch_reader->num_record_batches();
-            for (int i = 0; i < num_batches; ++i) {
+            std::vector<std::shared_ptr<arrow::RecordBatch>> batches(num_batches);
+            auto read_batch = [&batch_reader, &batches](int i) {
                 std::shared_ptr<arrow::RecordBatch> chunk;
-                status = batch_reader->ReadRecordBatch(i, &chunk);
+                arrow::Status status = batch_reader->ReadRecordBatch(i, &chunk);
                 if (!status.ok()) {
                     PSP_COMPLAIN_AND_ABORT(
                         "Failed to read file record batch: " + status.message());
                 }
-                batches.push_back(chunk);
+                batches[i] = chunk;
+            };
+
+            // The first read also loads the file's dictionaries, which is
+            // not thread safe, so it must happen before the rest fan out.
+            if (num_batches > 0) {
+                read_batch(0);
             }
+#ifdef PSP_PARALLEL_FOR
+            tbb::parallel_for(1, num_batches, 1, read_batch);
+#else
+            for (int i = 1; i < num_batches; ++i) {
+                read_batch(i);
+            }
+#endif
             status = arrow::Table::FromRecordBatches(batches, &table);
             if (!status.ok()) {
                 std::stringstream ss;
@@ -86,18 +99,29 @@ namespace apachearrow {
             PSP_COMPLAIN_AND_ABORT(ss.str());
         } else {
             std::shared_ptr<arrow::ipc::RecordBatchFileReader> batch_reader = *status;
-            std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
             auto num_batches = batch_reader->num_record_batches();
-            for (int i = 0; i < num_batches; ++i) {
-                
+            std::vector<std::shared_ptr<arrow::RecordBatch>> batches(num_batches);
+            auto read_batch = [&batch_reader, &batches](int i) {
                 auto status2 = batch_reader->ReadRecordBatch(i);
                 if (!status2.ok()) {
                     PSP_COMPLAIN_AND_ABORT(
                         "Failed to read file record batch: " + status2.status().ToString());
                 }
-                std::shared_ptr<arrow::RecordBatch> chunk = *status2;
-                batches.push_back(chunk);
+                batches[i] = *status2;
+            };
+
+            // The first read also loads the file's dictionaries, which is
+            // not thread safe, so it must happen before the rest fan out.
+            if (num_batches > 0) {
+                read_batch(0);
+            }
+#ifdef PSP_PARALLEL_FOR
+            tbb::parallel_for(1, num_batches, 1, read_batch);
+#else
+            for (int i = 1; i < num_batches; ++i) {
+                read_batch(i);
             }
+#endif
             auto status3 = arrow::Table::FromRecordBatches(batches);
             if (!status3.ok()) {
                 std::stringstream ss;
@@ -199,6 +223,12 @@ namespace apachearrow {
         std::shared_ptr<arrow::Schema> schema = m_table->schema();
         std::vector<std::shared_ptr<arrow::Field>> fields = schema->fields();
 
+        // Resolve target columns up front, as adding columns to `tbl` is not
+        // thread safe, then fill each column independently.
+        std::vector<std::int32_t> fill_cidxs;
+        std::vector<std::shared_ptr<t_column>> fill_cols;
+        std::vector<std::string> raw_types;
+
         for (long unsigned int cidx = 0; cidx < m_names.size(); ++cidx) {
             auto name = m_names[cidx];
             t_dtype type = m_types[cidx];
@@ -209,19 +239,34 @@ namespace apachearrow {
                 continue;
             }
 
-            auto raw_type = fields[cidx]->type()->name();
-
             if (name == "__INDEX__") {
                 implicit_index = true;
-                std::shared_ptr<t_column> pkey_col_sptr
-                    = tbl.add_column_sptr("psp_pkey", type, true);
-                fill_column(tbl, pkey_col_sptr, "psp_pkey", cidx, type, raw_type, is_update);
-                tbl.clone_column("psp_pkey", "psp_okey");
-                continue;
+                fill_cols.push_back(tbl.add_column_sptr("psp_pkey", type, true));
             } else {
-                auto col = tbl.get_column(name);
-                fill_column(tbl, col, name, cidx, type, raw_type, is_update);
+                fill_cols.push_back(tbl.get_column(name));
+            }
+
+            fill_cidxs.push_back(cidx);
+            raw_types.push_back(fields[cidx]->type()->name());
+        }
+
+#ifdef PSP_PARALLEL_FOR
+        tbb::parallel_for(0, int(fill_cols.size()), 1,
+            [&tbl, &fill_cidxs, &fill_cols, &raw_types, is_update, this](int idx)
+#else
+        for (t_uindex idx = 0, loop_end = fill_cols.size(); idx < loop_end; ++idx)
+#endif
+            {
+                std::int32_t cidx = fill_cidxs[idx];
+                fill_column(tbl, fill_cols[idx], m_names[cidx], cidx, m_types[cidx],
+                    raw_types[idx], is_update);
             }
+#ifdef PSP_PARALLEL_FOR
+        );
+#endif
+
+        if (implicit_index) {
+            tbl.clone_column("psp_pkey", "psp_okey");
         }
 
         // Fill index column - recreated every time a `t_data_table` is created.
@@ -249,6 +294,114 @@ namespace apachearrow {
         }
     }
 
+    template <typename T>
+    void
+    iter_dict_copy(std::shared_ptr<t_column> dest, std::shared_ptr<arrow::Array> src,
+        const std::vector<t_uindex>& vocab_ids, const int64_t offset, const int64_t len) {
+        std::shared_ptr<T> scol = std::static_pointer_cast<T>(src);
+        const typename T::value_type* vals = scol->raw_values();
+        t_uindex* base = dest->get_nth<t_uindex>(offset);
+        const t_uindex nids = vocab_ids.size();
+        for (int64_t i = 0; i < len; i++) {
+            // Null slots may hold any index, so bounds check before mapping.
+            t_uindex didx = static_cast<t_uindex>(vals[i]);
+            base[i] = didx < nids ? vocab_ids[didx] : 0;
+        }
+    }
+
+    template <typename T>
+    void
+    adopt_values(std::shared_ptr<t_column> dest, std::shared_ptr<arrow::Array> src,
+        std::shared_ptr<void> owner) {
+        std::shared_ptr<T> scol = std::static_pointer_cast<T>(src);
+
+        // The values buffer is usually a non-owning slice of the binary, but
+        // Arrow may also have copied it to realign it, so keep both alive.
+        typedef std::pair<std::shared_ptr<void>, std::shared_ptr<arrow::Buffer>> t_owners;
+        std::shared_ptr<void> owners = std::make_shared<t_owners>(owner, scol->values());
+        dest->adopt_data(scol->raw_values(), scol->length(), owners);
+    }
+
+    void
+    reserve_dictionaries(std::shared_ptr<t_column> dest,
+        const std::vector<std::shared_ptr<arrow::Array>>& dictionaries) {
+        std::uint64_t nbytes = 0;
+        std::uint64_t nstrings = 0;
+
+        for (const auto& dictionary : dictionaries) {
+            std::shared_ptr<arrow::StringArray> dict
+                = std::static_pointer_cast<arrow::StringArray>(dictionary);
+            const int32_t* offsets = dict->raw_value_offsets();
+            const std::uint64_t dsize = dict->length();
+            nbytes += (offsets[dsize] - offsets[0]) + dsize;
+            nstrings += dsize;
+        }
+
+        t_vocab* vocab = dest->_get_vocab();
+        vocab->reserve(
+            vocab->get_vlendata()->size() + nbytes, vocab->get_vlenidx() + nstrings);
+    }
+
+    std::vector<t_uindex>
+    intern_dictionary(std::shared_ptr<t_column> dest, std::shared_ptr<arrow::Array> dictionary) {
+        std::shared_ptr<arrow::StringArray> dict
+            = std::static_pointer_cast<arrow::StringArray>(dictionary);
+        const int32_t* offsets = dict->raw_value_offsets();
+        const uint8_t* values = dict->value_data()->data();
+        const std::uint64_t dsize = dict->length();
+
+        t_vocab* vocab = dest->_get_vocab();
+        std::vector<t_uindex> vocab_ids(dsize);
+        std::string elem;
+
+        for (std::uint64_t i = 0; i < dsize; ++i) {
+            std::int32_t bidx = offsets[i];
+            std::size_t es = offsets[i + 1] - bidx;
+            elem.assign(reinterpret_cast<const char*>(values) + bidx, es);
+            vocab_ids[i] = vocab->get_interned(elem);
+        }
+
+        return vocab_ids;
+    }
+
+    void
+    copy_dictionary_indices(std::shared_ptr<t_column> dest, std::shared_ptr<arrow::Array> src,
+        const std::vector<t_uindex>& vocab_ids, const int64_t offset, const int64_t len) {
+        auto indices = std::static_pointer_cast<arrow::DictionaryArray>(src)->indices();
+        switch (indices->type()->id()) {
+            case arrow::Int8Type::type_id: {
+                iter_dict_copy<::arrow::Int8Array>(dest, indices, vocab_ids, offset, len);
+            } break;
+            case ::arrow::UInt8Type::type_id: {
+                iter_dict_copy<::arrow::UInt8Array>(dest, indices, vocab_ids, offset, len);
+            } break;
+            case ::arrow::Int16Type::type_id: {
+                iter_dict_copy<::arrow::Int16Array>(dest, indices, vocab_ids, offset, len);
+            } break;
+            case ::arrow::UInt16Type::type_id: {
+                iter_dict_copy<::arrow::UInt16Array>(dest, indices, vocab_ids, offset, len);
+            } break;
+            case ::arrow::Int32Type::type_id: {
+                iter_dict_copy<::arrow::Int32Array>(dest, indices, vocab_ids, offset, len);
+            } break;
+            case ::arrow::UInt32Type::type_id: {
+                iter_dict_copy<::arrow::UInt32Array>(dest, indices, vocab_ids, offset, len);
+            } break;
+            case ::arrow::Int64Type::type_id: {
+                iter_dict_copy<::arrow::Int64Array>(dest, indices, vocab_ids, offset, len);
+            } break;
+            case ::arrow::UInt64Type::type_id: {
+                iter_dict_copy<::arrow::UInt64Array>(dest, indices, vocab_ids, offset, len);
+            } break;
+            default: {
+                std::stringstream ss;
+                ss << "Could not copy dictionary array indices of type'" 
+                   << indices->type()->name() << "'" << std::endl;
+                PSP_COMPLAIN_AND_ABORT(ss.str());
+            }
+        }
+    }
+
     template <typename T, typename V>
     void
     iter_col_copy(std::shared_ptr<t_column> dest, std::shared_ptr<arrow::Array> src,
@@ -269,55 +422,15 @@ namespace apachearrow {
                 // indices, i.e. [0 => a, 1 => b, 2 => a], tables with
                 // explicit indexes on a string column created from a dictionary
                 // array may have duplicate primary keys.
-                auto scol = std::static_pointer_cast<arrow::DictionaryArray>(src);
-                std::shared_ptr<arrow::StringArray> dict
-                    = std::static_pointer_cast<arrow::StringArray>(scol->dictionary());
-                const int32_t* offsets = dict->raw_value_offsets();
-                const uint8_t* values = dict->value_data()->data();
-                const std::uint64_t dsize = dict->length();
-
-                t_vocab* vocab = dest->_get_vocab();
-                std::string elem;
-
-                for (std::uint64_t i = 0; i < dsize; ++i) {
-                    std::int32_t bidx = offsets[i];
-                    std::size_t es = offsets[i + 1] - bidx;
-                    elem.assign(reinterpret_cast<const char*>(values) + bidx, es);
-                    vocab->get_interned(elem);
-                }
-                auto indices = scol->indices();
-                switch (indices->type()->id()) {
-                    case arrow::Int8Type::type_id: {
-                        iter_col_copy<::arrow::Int8Array, t_uindex>(dest, indices, offset, len);                    
-                    } break;
-                    case ::arrow::UInt8Type::type_id: {
-                        iter_col_copy<::arrow::UInt8Array, t_uindex>(dest, indices, offset, len);
-                    } break;
-                    case ::arrow::Int16Type::type_id: {
-                        iter_col_copy<::arrow::Int16Array, t_uindex>(dest, indices, offset, len);
-                    } break;
-                    case ::arrow::UInt16Type::type_id: {
-                        iter_col_copy<::arrow::UInt16Array, t_uindex>(dest, indices, offset, len);
-                    } break;
-                    case ::arrow::Int32Type::type_id: {
-                        iter_col_copy<::arrow::Int32Array, t_uindex>(dest, indices, offset, len);
-                    } break;
-                    case ::arrow::UInt32Type::type_id: {
-                        iter_col_copy<::arrow::UInt32Array, t_uindex>(dest, indices, offset, len);
-                    } break;
-                    case ::arrow::Int64Type::type_id: {
-                        iter_col_copy<::arrow::Int64Array, t_uindex>(dest, indices, offset, len);
-                    } break;
-                    case ::arrow::UInt64Type::type_id: {
-                        iter_col_copy<::arrow::UInt64Array, t_uindex>(dest, indices, offset, len);
-                    } break;
-                    default: {
-                        std::stringstream ss;
-                        ss << "Could not copy dictionary array indices of type'" 
-                           << indices->type()->name() << "'" << std::endl;
-                        PSP_COMPLAIN_AND_ABORT(ss.str());
-                    }
-                }
+                //
+                // Intern the dictionary once, then translate the indices
+                // through `vocab_ids` rather than assuming that dictionary
+                // positions and vocabulary ids line up.
+                std::shared_ptr<arrow::Array> dictionary
+                    = std::static_pointer_cast<arrow::DictionaryArray>(src)->dictionary();
+                reserve_dictionaries(dest, {dictionary});
+                std::vector<t_uindex> vocab_ids = intern_dictionary(dest, dictionary);
+                copy_dictionary_indices(dest, src, vocab_ids, offset, len);
             } break;
             case arrow::BinaryType::type_id:
             case arrow::StringType::type_id: {
@@ -326,13 +439,18 @@ namespace apachearrow {
                 const int32_t* offsets = scol->raw_value_offsets();
                 const uint8_t* values = scol->value_data()->data();
 
+                t_vocab* vocab = dest->_get_vocab();
+                t_uindex* base = dest->get_nth<t_uindex>(offset);
+
+                // `elem` is reused as the null-terminated scratch buffer, so
+                // interning allocates only when a longer string is seen.
                 std::string elem;
 
                 for (std::uint32_t i = 0; i < len; ++i) {
                     std::int32_t bidx = offsets[i];
                     std::size_t es = offsets[i + 1] - bidx;
                     elem.assign(reinterpret_cast<const char*>(values) + bidx, es);
-                    dest->set_nth(offset + i, elem);
+                    base[i] = vocab->get_interned(elem.c_str());
                 }
             } break;
             case arrow::Int8Type::type_id: {
@@ -462,7 +580,7 @@ namespace apachearrow {
             } break;
             case arrow::NullType::type_id: {
                 for (uint32_t i = 0; i < len; ++i) {
-                    dest->set_valid(i, false);
+                    dest->set_valid(offset + i, false);
                 }
             } break;
             default: {
@@ -474,6 +592,56 @@ namespace apachearrow {
         }
     }
 
+    bool
+    adopt_array(std::shared_ptr<t_column> dest, std::shared_ptr<arrow::Array> src,
+        std::shared_ptr<void> owner) {
+        switch (src->type()->id()) {
+            case arrow::Int8Type::type_id: {
+                adopt_values<arrow::Int8Array>(dest, src, owner);
+            } break;
+            case arrow::UInt8Type::type_id: {
+                adopt_values<arrow::UInt8Array>(dest, src, owner);
+            } break;
+            case arrow::Int16Type::type_id: {
+                adopt_values<arrow::Int16Array>(dest, src, owner);
+            } break;
+            case arrow::UInt16Type::type_id: {
+                adopt_values<arrow::UInt16Array>(dest, src, owner);
+            } break;
+            case arrow::Int32Type::type_id: {
+                adopt_values<arrow::Int32Array>(dest, src, owner);
+            } break;
+            case arrow::UInt32Type::type_id: {
+                adopt_values<arrow::UInt32Array>(dest, src, owner);
+            } break;
+            case arrow::Int64Type::type_id: {
+                adopt_values<arrow::Int64Array>(dest, src, owner);
+            } break;
+            case arrow::UInt64Type::type_id: {
+                adopt_values<arrow::UInt64Array>(dest, src, owner);
+            } break;
+            case arrow::FloatType::type_id: {
+                adopt_values<arrow::FloatArray>(dest, src, owner);
+            } break;
+            case arrow::DoubleType::type_id: {
+                adopt_values<arrow::DoubleArray>(dest, src, owner);
+            } break;
+            case arrow::TimestampType::type_id: {
+                // Only millisecond timestamps share `t_time`'s layout.
+                std::shared_ptr<arrow::TimestampType> tunit
+                    = std::static_pointer_cast<arrow::TimestampType>(src->type());
+                if (tunit->unit() != arrow::TimeUnit::MILLI) {
+                    return false;
+                }
+                adopt_values<arrow::TimestampArray>(dest, src, owner);
+            } break;
+            default: {
+                return false;
+            }
+        }
+        return true;
+    }
+
     // Defines the full matrix of type interactions between arrow arrays and
     // schema-defined tables.
     #define FILL_COLUMN_ITER(ARRAY_TYPE) \
@@ -517,19 +685,55 @@ namespace apachearrow {
     ArrowLoader::fill_column(t_data_table& tbl, std::shared_ptr<t_column> col,
         const std::string& name, std::int32_t cidx, t_dtype type, std::string& raw_type,
         bool is_update) {
-        int64_t offset = 0;
-        std::shared_ptr<arrow::ChunkedArray> carray = m_table->GetColumnByName(name);
+        std::shared_ptr<arrow::ChunkedArray> carray = m_table->column(cidx);
+        const int num_chunks = carray->num_chunks();
+
+        // `type`: arrow array dtype converted to `t_dtype`
+        // `column_dtype`: dtype of the `t_column`
+        t_dtype column_dtype = col->get_dtype();
+
+        // Row offset of each chunk in the column, so that chunks can be
+        // written to disjoint row ranges independently.
+        std::vector<int64_t> offsets(num_chunks + 1, 0);
+        for (auto i = 0; i < num_chunks; ++i) {
+            offsets[i + 1] = offsets[i] + carray->chunk(i)->length();
+        }
 
-        for(auto i = 0; i < carray->num_chunks(); ++i) {
+        // Dictionaries are merged into the column's vocab serially, after
+        // which each chunk only translates its indices. Consecutive chunks
+        // usually share a dictionary, which is only interned once.
+        bool is_dictionary = carray->type()->id() == arrow::DictionaryType::type_id;
+        std::vector<std::vector<t_uindex>> vocab_ids;
+        std::vector<std::size_t> chunk_vocab_ids(is_dictionary ? num_chunks : 0);
+
+        if (is_dictionary) {
+            std::vector<std::shared_ptr<arrow::Array>> dictionaries;
+            for (auto i = 0; i < num_chunks; ++i) {
+                std::shared_ptr<arrow::Array> dictionary
+                    = std::static_pointer_cast<arrow::DictionaryArray>(carray->chunk(i))
+                          ->dictionary();
+                if (dictionaries.empty()
+                    || (dictionary != dictionaries.back()
+                        && !dictionary->Equals(*dictionaries.back()))) {
+                    dictionaries.push_back(dictionary);
+                }
+                chunk_vocab_ids[i] = dictionaries.size() - 1;
+            }
+
+            reserve_dictionaries(col, dictionaries);
+            vocab_ids.reserve(dictionaries.size());
+            for (const auto& dictionary : dictionaries) {
+                vocab_ids.push_back(intern_dictionary(col, dictionary));
+            }
+        }
+
+        auto fill_chunk = [&](int i) {
             std::shared_ptr<arrow::Array> array = carray->chunk(i);
+            int64_t offset = offsets[i];
             int64_t len = array->length();
 
             // If the Arrow array schema is different from the data table
             // schema, iteratively fill.
-            t_dtype column_dtype = col->get_dtype();
-
-            // `type`: arrow array dtype converted to `t_dtype`
-            // `column_dtype`: dtype of the `t_column`
             if (type != column_dtype) {
                 switch (type) {
                     case DTYPE_INT8: {
@@ -570,28 +774,58 @@ namespace apachearrow {
                         PSP_COMPLAIN_AND_ABORT(ss.str());
                     };
                 }
+            } else if (is_dictionary) {
+                copy_dictionary_indices(col, array, vocab_ids[chunk_vocab_ids[i]], offset, len);
+            } else if (m_owner && num_chunks == 1
+                && static_cast<t_uindex>(len) == col->size()) {
+                if (!adopt_array(col, array, m_owner)) {
+                    copy_array(col, array, offset, len);
+                }
             } else {
                 copy_array(col, array, offset, len);
             }
 
             // Fill validity bitmap
             std::int64_t null_count = array->null_count();
-            if (null_count == 0) {
+            if (null_count == 0 && num_chunks == 1) {
                 col->valid_raw_fill();
             } else {
+                // `NullArray`s have no bitmap, and every slot is null.
                 const uint8_t* null_bitmap = array->null_bitmap_data();
+                const int64_t bitmap_offset = array->offset();
 
                 // arrow packs bools into a bitmap
-                for (uint32_t i = 0; i < len; ++i) {
-                    std::uint8_t elem = null_bitmap[i / 8];
-                    bool v = elem & (1 << (i % 8));
+                for (int64_t i = 0; i < len; ++i) {
+                    bool v = null_count == 0;
+                    if (null_bitmap != nullptr) {
+                        int64_t bit = bitmap_offset + i;
+                        v = null_bitmap[bit / 8] & (1 << (bit % 8));
+                    }
                     col->set_valid(offset + i, v);
                 }
             }
-            offset += len;
+        };
+
+#ifdef PSP_PARALLEL_FOR
+        // Non-dictionary string chunks all intern into the same vocab, so
+        // they must be filled in order.
+        bool parallel_chunks = column_dtype != DTYPE_STR || is_dictionary;
+
+        if (parallel_chunks && num_chunks > 1) {
+            tbb::parallel_for(0, num_chunks, 1, fill_chunk);
+            return;
+        }
+#endif
+        for (auto i = 0; i < num_chunks; ++i) {
+            fill_chunk(i);
         }
     }
 
+    void
+    ArrowLoader::set_zero_copy(std::shared_ptr<void> owner) {
+        m_owner = owner;
+    }
+
     // Getters
 
     std::uint32_t
@@ -194,6 +194,12 @@ t_column::get_interned(const char* s) {
     return m_vocab->get_interned(s);
 }
 
+bool
+t_column::string_exists(const char* s, t_uindex& interned) const {
+    COLUMN_CHECK_STRCOL();
+    return m_vocab->string_exists(s, interned);
+}
+
 template <>
 void
 t_column::push_back<const char*>(const char* elem) {
@@ -321,6 +327,24 @@ t_column::size() const {
     return m_size;
 }
 
+t_uindex
+t_column::get_memory_usage() const {
+    t_uindex rv = 0;
+    if (m_data) {
+        rv += m_data->capacity();
+    }
+
+    if (m_status_enabled && m_status) {
+        rv += m_status->capacity();
+    }
+
+    if (m_isvlen && m_vocab) {
+        rv += m_vocab->nbytes();
+    }
+
+    return rv;
+}
+
 void
 t_column::set_size(t_uindex size) {
 #ifdef PSP_COLUMN_VERIFY
@@ -341,6 +365,26 @@ t_column::reserve(t_uindex size) {
         m_status->reserve(get_dtype_size(DTYPE_UINT8) * size);
 }
 
+void
+t_column::shrink(t_uindex size) {
+    size = std::max(size, m_size);
+    m_data->shrink(get_dtype_size(m_dtype) * size);
+    if (is_status_enabled())
+        m_status->shrink(get_dtype_size(DTYPE_UINT8) * size);
+}
+
+void
+t_column::adopt_data(const void* base, t_uindex size, std::shared_ptr<void> owner) {
+    PSP_VERBOSE_ASSERT(!m_isvlen, "Cannot adopt storage for a variable length column");
+    m_data->adopt(const_cast<void*>(base), size * get_dtype_size(m_dtype), owner);
+    m_size = size;
+
+    if (is_status_enabled() && m_status->size() < size) {
+        m_status->reserve(size);
+        m_status->set_size(size);
+    }
+}
+
 //object storage, specialize only for std::uint64_t
 template <>
 void t_column::object_copied<std::uint64_t>(std::uint64_t ptr) const {}
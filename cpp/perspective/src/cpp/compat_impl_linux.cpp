@@ -140,6 +140,15 @@ psp_curmem() {
     return result.m_resident * multiplier;
 }
 
+std::uint64_t
+psp_thread_id() {
+#ifdef PSP_ENABLE_WASM
+    return 0;
+#else
+    return syscall(__NR_gettid);
+#endif
+}
+
 void
 set_thread_name(std::thread& thr, const std::string& name) {
 #ifdef PSP_PARALLEL_FOR
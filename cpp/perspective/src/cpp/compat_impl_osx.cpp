@@ -22,7 +22,9 @@
 #include <sys/syscall.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <pthread.h>
 #include <stdio.h>
+#include <mach/mach.h>
 
 namespace perspective {
 static void map_file_internal_(const std::string& fname, t_fflag fflag, t_fflag fmode,
@@ -120,29 +122,20 @@ get_page_size() {
 
 std::int64_t
 psp_curmem() {
-    static double multiplier = getpagesize() / 1024000.;
-
-    struct t_statm {
-        long int m_size, m_resident, m_share, m_text, m_lib, m_data, m_dt;
-    };
-
-    t_statm result;
-
-    const char* statm_path = "/proc/self/statm";
-
-    FILE* f = fopen(statm_path, "r");
-    if (!f) {
-        perror(statm_path);
-        abort();
-    }
-
-    PSP_VERBOSE_ASSERT(
-        fscanf(f, "%ld %ld %ld %ld %ld %ld %ld", &result.m_size, &result.m_resident,
-            &result.m_share, &result.m_text, &result.m_lib, &result.m_data, &result.m_dt)
-            == 7,
-        "Failed to read memory size");
-    fclose(f);
-    return result.m_resident * multiplier;
+    // macOS has no `/proc`, so ask the kernel for the task's resident size.
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    kern_return_t rcode = task_info(
+        mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count);
+    PSP_VERBOSE_ASSERT(rcode == KERN_SUCCESS, "Failed to read memory size");
+    return info.resident_size / 1024000.;
+}
+
+std::uint64_t
+psp_thread_id() {
+    std::uint64_t tid = 0;
+    pthread_threadid_np(nullptr, &tid);
+    return tid;
 }
 
 void
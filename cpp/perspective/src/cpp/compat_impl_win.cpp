@@ -127,7 +127,13 @@ int64_t
 psp_curmem() {
     PROCESS_MEMORY_COUNTERS mem;
     GetProcessMemoryInfo(GetCurrentProcess(), &mem, sizeof(mem));
-    return mem.WorkingSetSize / 1024;
+    // In MB, as on Linux and OS X
+    return mem.WorkingSetSize / 1024000;
+}
+
+std::uint64_t
+psp_thread_id() {
+    return GetCurrentThreadId();
 }
 
 #pragma pack(push, 8)
@@ -530,10 +530,11 @@ t_tscalar hour_of_day<DTYPE_TIME>(t_tscalar x) {
     // Use localtime so that the hour of day is consistent with all output
     // datetimes, which are in local time
     std::time_t temp = std::chrono::system_clock::to_time_t(ts);
-    std::tm* t = std::localtime(&temp);
+    std::tm t;
+    if (!local_tm(temp, t)) return rval;
 
     // Get the hour from the resulting `std::tm`
-    rval.set(static_cast<std::int64_t>(t->tm_hour));
+    rval.set(static_cast<std::int64_t>(t.tm_hour));
     return rval;
 }
 
@@ -622,14 +623,15 @@ t_tscalar day_bucket<DTYPE_TIME>(t_tscalar x) {
     std::time_t temp = std::chrono::system_clock::to_time_t(ts);
 
     // Convert to a std::tm
-    std::tm* t = std::localtime(&temp);
+    std::tm t;
+    if (!local_tm(temp, t)) return rval;
 
     // Get the year and create a new `t_date`
-    std::int32_t year = static_cast<std::int32_t>(t->tm_year + 1900);
+    std::int32_t year = static_cast<std::int32_t>(t.tm_year + 1900);
 
     // Month in `t_date` is [0-11]
-    std::int32_t month = static_cast<std::uint32_t>(t->tm_mon);
-    std::uint32_t day = static_cast<std::uint32_t>(t->tm_mday);
+    std::int32_t month = static_cast<std::uint32_t>(t.tm_mon);
+    std::uint32_t day = static_cast<std::uint32_t>(t.tm_mday);
 
     rval.set(t_date(year, month, day));
     return rval;
@@ -683,15 +685,16 @@ t_tscalar week_bucket<DTYPE_TIME>(t_tscalar x) {
 
     // Convert the timestamp to local time
     std::time_t temp = std::chrono::system_clock::to_time_t(ts);
-    std::tm* t = std::localtime(&temp);
+    std::tm t;
+    if (!local_tm(temp, t)) return rval;
 
     // Take the ymd from the `tm`, now in local time, and create a
     // date::year_month_day.
-    date::year year {1900 + t->tm_year};
+    date::year year {1900 + t.tm_year};
 
     // date::month is [1-12], whereas `std::tm::tm_mon` is [0-11]
-    date::month month {static_cast<std::uint32_t>(t->tm_mon) + 1};
-    date::day day {static_cast<std::uint32_t>(t->tm_mday)};
+    date::month month {static_cast<std::uint32_t>(t.tm_mon) + 1};
+    date::day day {static_cast<std::uint32_t>(t.tm_mday)};
     date::year_month_day ymd(year, month, day);
 
     // Convert to a `sys_days` representing no. of days since epoch
@@ -735,11 +738,12 @@ t_tscalar month_bucket<DTYPE_TIME>(t_tscalar x) {
 
     // Convert the timestamp to local time
     std::time_t temp = std::chrono::system_clock::to_time_t(ts);
-    std::tm* t = std::localtime(&temp);
+    std::tm t;
+    if (!local_tm(temp, t)) return rval;
 
     // Use the `tm` to create the `t_date`
-    std::int32_t year = static_cast<std::int32_t>(t->tm_year + 1900);
-    std::int32_t month = static_cast<std::uint32_t>(t->tm_mon);
+    std::int32_t year = static_cast<std::int32_t>(t.tm_year + 1900);
+    std::int32_t month = static_cast<std::uint32_t>(t.tm_mon);
     rval.set(t_date(year, month, 1));
     return rval;
 }
@@ -767,10 +771,11 @@ t_tscalar year_bucket<DTYPE_TIME>(t_tscalar x) {
 
     // Convert the timestamp to local time
     std::time_t temp = std::chrono::system_clock::to_time_t(ts);
-    std::tm* t = std::localtime(&temp);
+    std::tm t;
+    if (!local_tm(temp, t)) return rval;
 
     // Use the `tm` to create the `t_date`
-    std::int32_t year = static_cast<std::int32_t>(t->tm_year + 1900);
+    std::int32_t year = static_cast<std::int32_t>(t.tm_year + 1900);
     rval.set(t_date(year, 0, 1));
     return rval;
 }
@@ -844,11 +849,15 @@ void day_of_week<DTYPE_TIME>(
     // Use localtime so that the hour of day is consistent with all output
     // datetimes, which are in local time
     std::time_t temp = std::chrono::system_clock::to_time_t(ts);
-    std::tm* t = std::localtime(&temp);
+    std::tm t;
+    if (!local_tm(temp, t)) {
+        output_column->clear(idx);
+        return;
+    }
 
     // Get the weekday from the resulting `std::tm`
     output_column->set_nth(
-        idx, days_of_week[t->tm_wday]);
+        idx, days_of_week[t.tm_wday]);
 }
 
 template <>
@@ -884,10 +893,14 @@ void month_of_year<DTYPE_TIME>(
     // Use localtime so that the hour of day is consistent with all output
     // datetimes, which are in local time
     std::time_t temp = std::chrono::system_clock::to_time_t(ts);
-    std::tm* t = std::localtime(&temp);
+    std::tm t;
+    if (!local_tm(temp, t)) {
+        output_column->clear(idx);
+        return;
+    }
 
     // Get the month from the resulting `std::tm`
-    auto month = t->tm_mon;
+    auto month = t.tm_mon;
 
     // Get the month string and write into the output column
     output_column->set_nth(idx, months_of_year[month]);
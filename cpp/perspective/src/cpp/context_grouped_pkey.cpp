@@ -27,11 +27,19 @@ namespace perspective {
 
 t_ctx_grouped_pkey::t_ctx_grouped_pkey()
     : m_depth(0)
-    , m_depth_set(false) {}
+    , m_depth_set(false)
+    , m_incremental(false)
+    , m_rebuilt(false)
+    , m_rows_updated(false)
+    , m_next_nidx(1) {}
 
 t_ctx_grouped_pkey::t_ctx_grouped_pkey(t_schema schema, t_config config)
     : m_depth(0)
-    , m_depth_set(false) {
+    , m_depth_set(false)
+    , m_incremental(false)
+    , m_rebuilt(false)
+    , m_rows_updated(false)
+    , m_next_nidx(1) {
     PSP_COMPLAIN_AND_ABORT("Not Implemented");
 }
 
@@ -179,7 +187,296 @@ t_ctx_grouped_pkey::notify(const t_data_table& flattened, const t_data_table& de
     const t_data_table& existed) {
     PSP_TRACE_SENTINEL();
     PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    psp_log_time(repr() + " notify.enter");
+
+    if (!m_incremental) {
+        rebuild();
+        psp_log_time(repr() + " notify.exit");
+        return;
+    }
+
+    t_uindex nrecs = flattened.size();
+    std::shared_ptr<const t_column> pkey_sptr = flattened.get_const_column("psp_pkey");
+    std::shared_ptr<const t_column> op_sptr = flattened.get_const_column("psp_op");
+    const t_column* pkey_col = pkey_sptr.get();
+    const t_column* op_col = op_sptr.get();
+
+    const std::string& child_col_name = m_config.get_child_pkey_column();
+    std::shared_ptr<const t_column> child_sptr = current.get_const_column(child_col_name);
+    std::shared_ptr<const t_column> parent_sptr
+        = current.get_const_column(m_config.get_parent_pkey_column());
+    std::shared_ptr<const t_column> sortby_sptr
+        = current.get_const_column(m_config.get_sort_by(child_col_name));
+    const t_column* child_col = child_sptr.get();
+    const t_column* parent_col = parent_sptr.get();
+    const t_column* sortby_col = sortby_sptr.get();
+
+    // As in `rebuild`, only identity aggregates are read from the table
+    auto aggtable = m_tree->_get_aggtable();
+    std::vector<std::pair<t_column*, const t_column*>> identity_cols;
+    for (const auto& spec : m_config.get_aggregates()) {
+        if (spec.agg() == AGGTYPE_IDENTITY) {
+            const std::string& depname = spec.get_first_depname();
+            identity_cols.push_back(std::make_pair(aggtable->get_column(depname).get(),
+                current.get_const_column(depname).get()));
+        }
+    }
+
+    bool has_filters = m_config.has_filters();
+    t_mask msk_curr = has_filters ? filter_table_for_config(current, m_config) : t_mask();
+    m_rows_updated = nrecs > 0;
+
+    for (t_uindex idx = 0; idx < nrecs; ++idx) {
+        t_tscalar pkey = m_symtable.get_interned_tscalar(pkey_col->get_scalar(idx));
+        std::uint8_t op_ = *(op_col->get_nth<std::uint8_t>(idx));
+        t_op op = static_cast<t_op>(op_);
+
+        if (op == OP_DELETE || (has_filters && !msk_curr.get(idx))) {
+            auto iter = m_pkey_nidx.find(pkey);
+            if (iter != m_pkey_nidx.end()) {
+                remove_row(pkey, iter->second);
+            }
+            continue;
+        }
+
+        t_tscalar child = m_symtable.get_interned_tscalar(child_col->get_scalar(idx));
+        t_tscalar parent = m_symtable.get_interned_tscalar(parent_col->get_scalar(idx));
+        t_tscalar sort_value = m_symtable.get_interned_tscalar(sortby_col->get_scalar(idx));
+
+        if (!update_row(pkey, child, parent, sort_value)) {
+            psp_log_time(repr() + " notify.rebuild");
+            rebuild();
+            psp_log_time(repr() + " notify.exit");
+            return;
+        }
+
+        t_uindex nidx = m_pkey_nidx.at(pkey);
+        if (nidx >= aggtable->size()) {
+            aggtable->extend(nidx + 1);
+        }
+
+        for (const auto& cols : identity_cols) {
+            cols.first->set_scalar(nidx, cols.second->get_scalar(idx));
+        }
+    }
+
+    psp_log_time(repr() + " notify.exit");
+}
+
+bool
+t_ctx_grouped_pkey::update_row(const t_tscalar& pkey, const t_tscalar& child,
+    const t_tscalar& parent, const t_tscalar& sort_value) {
+    t_uindex pidx = resolve_parent(child, parent);
+    bool orphan = pidx == 0 && parent.is_valid() && parent != child;
+    auto iter = m_pkey_nidx.find(pkey);
+
+    if (iter == m_pkey_nidx.end()) {
+        if (m_child_nidx.find(child) != m_child_nidx.end()) {
+            return false;
+        }
+
+        t_uindex nidx = gen_nidx();
+        t_stnode node(nidx, pidx, child, m_tree->get_depth(pidx) + 1, sort_value, 1, nidx);
+        m_tree->insert_node(node);
+        m_tree->add_pkey(nidx, pkey);
+        m_pkey_nidx[pkey] = nidx;
+        m_child_nidx[child] = nidx;
+        m_nidx_parent[nidx] = parent;
+        set_orphan(nidx, parent, orphan);
+        add_to_traversal(nidx);
+
+        // Adopt the root children that were waiting for this key
+        auto oiter = m_orphans.find(child);
+        if (oiter == m_orphans.end()) {
+            return true;
+        }
+
+        std::vector<t_uindex> adopted(oiter->second.begin(), oiter->second.end());
+        m_orphans.erase(oiter);
+        auto ancestry = m_tree->get_ancestry(nidx);
+
+        for (auto onidx : adopted) {
+            if (std::find(ancestry.begin(), ancestry.end(), onidx) != ancestry.end()) {
+                return false;
+            }
+
+            if (!move_node(onidx, nidx, m_tree->get_sortby_value(onidx))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    t_uindex nidx = iter->second;
+    t_stnode node = m_tree->get_node(nidx);
+
+    // The child key identifies the node, so changing it changes the shape
+    // of the tree around it.
+    if (node.m_value != child) {
+        return false;
+    }
+
+    t_tscalar old_parent = m_nidx_parent.at(nidx);
+    if (old_parent != parent) {
+        set_orphan(nidx, old_parent, false);
+        m_nidx_parent[nidx] = parent;
+    }
+
+    set_orphan(nidx, parent, orphan);
+
+    if (pidx == node.m_pidx && sort_value == node.m_sort_value) {
+        return true;
+    }
+
+    if (pidx != node.m_pidx) {
+        auto ancestry = m_tree->get_ancestry(pidx);
+        if (std::find(ancestry.begin(), ancestry.end(), nidx) != ancestry.end()) {
+            return false;
+        }
+    }
+
+    return move_node(nidx, pidx, sort_value);
+}
+
+void
+t_ctx_grouped_pkey::remove_row(const t_tscalar& pkey, t_uindex nidx) {
+    remove_from_traversal(nidx);
+    t_tscalar child = m_tree->get_value(nidx);
+
+    // Children of a removed row become root children, as they would after
+    // a rebuild, until a row with this key is added again.
+    for (auto cidx : m_tree->get_child_idx(nidx)) {
+        move_node(cidx, 0, m_tree->get_sortby_value(cidx));
+        set_orphan(cidx, child, true);
+    }
+
+    m_tree->remove_pkey(nidx, pkey);
+    m_tree->remove_node(nidx);
+
+    for (auto col : m_tree->_get_aggtable()->get_columns()) {
+        col->set_valid(nidx, false);
+    }
+
+    set_orphan(nidx, m_nidx_parent.at(nidx), false);
+    m_nidx_parent.erase(nidx);
+    m_child_nidx.erase(child);
+    m_pkey_nidx.erase(pkey);
+    m_free_nidx.push_back(nidx);
+}
+
+bool
+t_ctx_grouped_pkey::move_node(t_uindex nidx, t_uindex pidx, const t_tscalar& sort_value) {
+    remove_from_traversal(nidx);
+
+    t_stnode node = m_tree->get_node(nidx);
+    std::uint8_t depth = m_tree->get_depth(pidx) + 1;
+    std::int32_t depth_change = static_cast<std::int32_t>(depth) - node.m_depth;
+
+    node.m_pidx = pidx;
+    node.m_depth = depth;
+    node.m_sort_value = sort_value;
+
+    if (!m_tree->update_node(node)) {
+        return false;
+    }
+
+    if (depth_change != 0) {
+        for (auto didx : m_tree->get_descendents(nidx)) {
+            t_stnode dnode = m_tree->get_node(didx);
+            dnode.m_depth += depth_change;
+            m_tree->update_node(dnode);
+        }
+    }
+
+    add_to_traversal(nidx);
+    return true;
+}
+
+void
+t_ctx_grouped_pkey::add_to_traversal(t_uindex nidx) {
+    // Only inserted if every ancestor is expanded
+    auto ancestry = m_tree->get_ancestry(nidx);
+    t_uindex osize = m_traversal->size();
+    m_traversal->add_node(m_sortby, ancestry, ancestry.size() - 1);
+    if (m_traversal->size() != osize) {
+        m_rows_changed = true;
+    }
+}
+
+void
+t_ctx_grouped_pkey::remove_from_traversal(t_uindex nidx) {
+    t_index tvidx = m_traversal->get_traversal_index(m_tree->get_ancestry(nidx));
+    if (tvidx > 0) {
+        m_traversal->remove_subtree(tvidx);
+        m_rows_changed = true;
+    }
+}
+
+void
+t_ctx_grouped_pkey::set_orphan(t_uindex nidx, const t_tscalar& parent, bool orphan) {
+    if (orphan) {
+        m_orphans[parent].insert(nidx);
+        return;
+    }
+
+    if (m_orphans.find(parent) == m_orphans.end()) {
+        return;
+    }
+
+    auto& orphans = m_orphans[parent];
+    orphans.erase(nidx);
+    if (orphans.empty()) {
+        m_orphans.erase(parent);
+    }
+}
+
+t_uindex
+t_ctx_grouped_pkey::resolve_parent(const t_tscalar& child, const t_tscalar& parent) const {
+    if (!parent.is_valid() || parent == child) {
+        return 0;
+    }
+
+    auto iter = m_child_nidx.find(parent);
+    return iter == m_child_nidx.end() ? 0 : iter->second;
+}
+
+void
+t_ctx_grouped_pkey::verify_incremental() {
+    auto snapshot = [this]() {
+        std::map<t_tscalar, std::vector<t_tscalar>> rows;
+        auto aggtable = m_tree->get_aggtable();
+        for (const auto& kv : m_pkey_nidx) {
+            t_stnode node = m_tree->get_node(kv.second);
+            std::vector<t_tscalar>& row = rows[kv.first];
+            row.push_back(node.m_value);
+            row.push_back(node.m_pidx == 0 ? mknone() : m_tree->get_value(node.m_pidx));
+            row.push_back(mktscalar<std::uint64_t>(node.m_depth));
+            row.push_back(node.m_sort_value);
+            for (const auto& spec : m_config.get_aggregates()) {
+                if (spec.agg() == AGGTYPE_IDENTITY) {
+                    row.push_back(aggtable->get_const_column(spec.get_first_depname())
+                                      ->get_scalar(node.m_aggidx));
+                }
+            }
+        }
+        return rows;
+    };
+
+    auto incremental = snapshot();
     rebuild();
+    PSP_VERBOSE_ASSERT(snapshot() == incremental, "Incremental update differs from rebuild");
+}
+
+t_uindex
+t_ctx_grouped_pkey::gen_nidx() {
+    if (!m_free_nidx.empty()) {
+        t_uindex nidx = m_free_nidx.back();
+        m_free_nidx.pop_back();
+        return nidx;
+    }
+
+    return m_next_nidx++;
 }
 
 void
@@ -187,15 +484,41 @@ t_ctx_grouped_pkey::step_begin() {
     PSP_TRACE_SENTINEL();
     PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
     reset_step_state();
+    m_rebuilt = false;
+    m_rows_updated = false;
 }
 
 void
 t_ctx_grouped_pkey::step_end() {
     PSP_TRACE_SENTINEL();
     PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
-    sort_by(m_sortby);
-    if (m_depth_set) {
+
+    // `rebuild` has already sorted the new traversal.
+    if (m_rebuilt) {
+        if (m_depth_set) {
+            set_depth(m_depth);
+        }
+        return;
+    }
+
+    if (!m_rows_updated) {
+        return;
+    }
+
+#ifdef PSP_GNODE_VERIFY
+    verify_incremental();
+#endif
+
+    // The incremental path keeps nodes in tree order, so only an explicit
+    // sort, which may depend on the updated values, is reapplied, and the
+    // depth only if nodes were (re)inserted collapsed.
+    if (!m_sortby.empty()) {
+        m_traversal->sort_by(m_config, m_sortby, *this);
+    }
+
+    if (m_depth_set && m_rows_changed) {
         set_depth(m_depth);
+        m_rows_changed = true;
     }
 }
 
@@ -430,6 +753,15 @@ t_ctx_grouped_pkey::reset() {
     m_tree->init();
     m_tree->set_deltas_enabled(get_feature_state(CTX_FEAT_DELTA));
     m_traversal = std::shared_ptr<t_traversal>(new t_traversal(m_tree));
+
+    // The next notify rebuilds from the table
+    m_incremental = false;
+    m_pkey_nidx.clear();
+    m_child_nidx.clear();
+    m_nidx_parent.clear();
+    m_orphans.clear();
+    m_free_nidx.clear();
+    m_next_nidx = 1;
 }
 
 void
@@ -450,6 +782,16 @@ t_ctx_grouped_pkey::get_trees() {
     return rval;
 }
 
+void
+t_ctx_grouped_pkey::get_memory_usage(t_memory_usage& usage) const {
+    m_tree->get_memory_usage(usage);
+    usage["traversal"] += m_traversal->get_memory_usage();
+    usage["symtable"] += m_symtable.get_memory_usage();
+    usage["tree"] += hash_memory_usage(m_pkey_nidx) + hash_memory_usage(m_child_nidx)
+        + hash_memory_usage(m_nidx_parent) + hash_memory_usage(m_orphans)
+        + vector_memory_usage(m_free_nidx);
+}
+
 bool
 t_ctx_grouped_pkey::has_deltas() const {
     PSP_TRACE_SENTINEL();
@@ -463,6 +805,7 @@ rebuild_helper(t_column*) {}
 
 void
 t_ctx_grouped_pkey::rebuild() {
+    m_rebuilt = true;
     auto tbl = m_gstate->get_pkeyed_table();
 
     if (m_config.has_filters()) {
@@ -487,8 +830,10 @@ t_ctx_grouped_pkey::rebuild() {
     reset();
 
     t_uindex nrows = child_col->size();
+    m_next_nidx = nrows + 1;
 
     if (nrows == 0) {
+        m_incremental = true;
         return;
     }
 
@@ -571,6 +916,8 @@ t_ctx_grouped_pkey::rebuild() {
         sortidx_map[data[idx].m_idx] = idx;
     }
 
+    t_uindex ninserted = 0;
+
     while (!queue.empty()) {
         // ridx is in sorted space
         t_uindex ridx = queue.front();
@@ -590,8 +937,17 @@ t_ctx_grouped_pkey::rebuild() {
 
         t_stnode node(nidx, pidx, value, pnode.m_depth + 1, sortby_value, 1, nidx);
 
-        m_tree->insert_node(node);
-        m_tree->add_pkey(nidx, m_symtable.get_interned_tscalar(rec.m_pkey));
+        if (m_tree->insert_node(node).second) {
+            ++ninserted;
+        }
+
+        auto pkey = m_symtable.get_interned_tscalar(rec.m_pkey);
+        auto parent = m_symtable.get_interned_tscalar(rec.m_parent);
+        m_tree->add_pkey(nidx, pkey);
+        m_pkey_nidx[pkey] = nidx;
+        m_child_nidx[value] = nidx;
+        m_nidx_parent[nidx] = parent;
+        set_orphan(nidx, parent, rec.m_is_rchild && parent.is_valid() && parent != value);
 
         auto riter = p_range_map.find(rec.m_child);
 
@@ -607,6 +963,10 @@ t_ctx_grouped_pkey::rebuild() {
     }
 
     psp_log_time(repr() + " rebuild.post_queue");
+
+    // Rows left out of the tree, by duplicate child keys or cycles of
+    // parents, cannot be tracked incrementally.
+    m_incremental = ninserted == nrows && child_ridx_map.size() == nrows;
     auto aggtable = m_tree->_get_aggtable();
     aggtable->extend(nrows + 1);
 
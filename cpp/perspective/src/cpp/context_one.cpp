@@ -109,18 +109,21 @@ t_ctx1::get_data(t_index start_row, t_index end_row, t_index start_col, t_index
     t_index nrows = ext.m_erow - ext.m_srow;
     t_index stride = ext.m_ecol - ext.m_scol;
 
-    std::vector<t_tscalar> tmpvalues(nrows * ncols);
     std::vector<t_tscalar> values(nrows * stride);
 
-    std::vector<const t_column*> aggcols(m_config.get_num_aggregates());
+    // Column 0 is the row's tree value and column `1 + aggidx` its
+    // aggregate, so only the aggregates in the window are read.
+    t_index begin_agg = std::max(ext.m_scol, t_index(1)) - 1;
+    t_index end_agg = std::max(ext.m_ecol, t_index(1)) - 1;
+    std::vector<const t_column*> aggcols(std::max(end_agg - begin_agg, t_index(0)));
 
     auto aggtable = m_tree->get_aggtable();
-    t_schema aggschema = aggtable->get_schema();
+    const t_schema& aggschema = aggtable->get_schema();
     auto none = mknone();
 
-    for (t_uindex aggidx = 0, loop_end = aggcols.size(); aggidx < loop_end; ++aggidx) {
+    for (t_index aggidx = begin_agg; aggidx < end_agg; ++aggidx) {
         const std::string& aggname = aggschema.m_columns[aggidx];
-        aggcols[aggidx] = aggtable->get_const_column(aggname).get();
+        aggcols[aggidx - begin_agg] = aggtable->get_const_column(aggname).get();
     }
 
     const std::vector<t_aggspec>& aggspecs = m_config.get_aggregates();
@@ -132,25 +135,21 @@ t_ctx1::get_data(t_index start_row, t_index end_row, t_index start_col, t_index
         t_uindex agg_ridx = m_tree->get_aggidx(nidx);
         t_index agg_pridx = pnidx == INVALID_INDEX ? INVALID_INDEX : m_tree->get_aggidx(pnidx);
 
-        t_tscalar tree_value = m_tree->get_value(nidx);
-        tmpvalues[(ridx - ext.m_srow) * ncols] = tree_value;
+        t_index row_offset = (ridx - ext.m_srow) * stride;
 
-        for (t_index aggidx = 0, loop_end = aggcols.size(); aggidx < loop_end; ++aggidx) {
-            t_tscalar value
-                = extract_aggregate(aggspecs[aggidx], aggcols[aggidx], agg_ridx, agg_pridx);
+        if (ext.m_scol == 0 && stride > 0) {
+            values[row_offset] = m_tree->get_value(nidx);
+        }
+
+        for (t_index aggidx = begin_agg; aggidx < end_agg; ++aggidx) {
+            t_tscalar value = extract_aggregate(
+                aggspecs[aggidx], aggcols[aggidx - begin_agg], agg_ridx, agg_pridx);
             if (!value.is_valid())
                 value.set(none); // todo: fix null handling
-            tmpvalues[(ridx - ext.m_srow) * ncols + 1 + aggidx].set(value);
+            values[row_offset + 1 + aggidx - ext.m_scol].set(value);
         }
     }
 
-    for (auto ridx = ext.m_srow; ridx < ext.m_erow; ++ridx) {
-        for (auto cidx = ext.m_scol; cidx < ext.m_ecol; ++cidx) {
-            auto insert_idx = (ridx - ext.m_srow) * stride + cidx - ext.m_scol;
-            auto src_idx = (ridx - ext.m_srow) * ncols + cidx;
-            values[insert_idx].set(tmpvalues[src_idx]);
-        }
-    }
     return values;
 }
 
@@ -161,7 +160,6 @@ t_ctx1::get_data(const std::vector<t_uindex>& rows) const {
     t_uindex nrows = rows.size();
     t_uindex ncols = get_column_count();
 
-    std::vector<t_tscalar> tmpvalues(nrows * ncols);
     std::vector<t_tscalar> values(nrows * ncols);
 
     std::vector<const t_column*> aggcols(m_config.get_num_aggregates());
@@ -187,21 +185,14 @@ t_ctx1::get_data(const std::vector<t_uindex>& rows) const {
         t_index agg_pridx = pnidx == INVALID_INDEX ? INVALID_INDEX : m_tree->get_aggidx(pnidx);
 
         t_tscalar tree_value = m_tree->get_value(nidx);
-        tmpvalues[idx * ncols] = tree_value;
+        values[idx * ncols] = tree_value;
 
         for (t_index aggidx = 0, loop_end = aggcols.size(); aggidx < loop_end; ++aggidx) {
             t_tscalar value
                 = extract_aggregate(aggspecs[aggidx], aggcols[aggidx], agg_ridx, agg_pridx);
             if (!value.is_valid())
                 value.set(none); // todo: fix null handling
-            tmpvalues[idx * ncols + 1 + aggidx].set(value);
-        }
-    }
-
-    for (t_uindex ridx = 0; ridx < nrows; ++ridx) {
-        for (t_uindex cidx = 0; cidx < ncols; ++cidx) {
-            t_uindex idx = ridx * ncols + cidx;
-            values[idx].set(tmpvalues[idx]);
+            values[idx * ncols + 1 + aggidx].set(value);
         }
     }
 
@@ -492,6 +483,12 @@ t_ctx1::get_trees() {
     return rval;
 }
 
+void
+t_ctx1::get_memory_usage(t_memory_usage& usage) const {
+    m_tree->get_memory_usage(usage);
+    usage["traversal"] += m_traversal->get_memory_usage();
+}
+
 bool
 t_ctx1::has_deltas() const {
     PSP_TRACE_SENTINEL();
@@ -15,6 +15,7 @@
 #include <perspective/tree_context_common.h>
 #include <perspective/logtime.h>
 #include <perspective/traversal.h>
+#include <limits>
 
 namespace perspective {
 
@@ -197,53 +198,69 @@ t_ctx2::get_data(t_index start_row, t_index end_row, t_index start_col, t_index
     auto ext = sanitize_get_data_extents(
         ctx_nrows, ctx_ncols, start_row, end_row, start_col, end_col);
 
+    std::vector<t_uindex> columns;
+    columns.reserve(std::max(ext.m_ecol - ext.m_scol, t_index(0)));
+    for (t_index cidx = ext.m_scol; cidx < ext.m_ecol; ++cidx) {
+        columns.push_back(cidx);
+    }
+
+    return get_data(ext.m_srow, ext.m_erow, columns);
+}
+
+std::vector<t_tscalar>
+t_ctx2::get_data(
+    t_index start_row, t_index end_row, const std::vector<t_uindex>& columns) const {
+    t_uindex ctx_nrows = get_row_count();
+    t_uindex ctx_ncols = get_column_count();
+    auto ext = sanitize_get_data_extents(ctx_nrows, ctx_ncols, start_row, end_row, 0, ctx_ncols);
+
+    t_index nrows = ext.m_erow - ext.m_srow;
+    t_index stride = columns.size();
+
     std::vector<std::pair<t_uindex, t_uindex>> cells;
+    cells.reserve(nrows * stride);
     for (t_index ridx = ext.m_srow; ridx < ext.m_erow; ++ridx) {
-        for (t_index cidx = ext.m_scol; cidx < ext.m_ecol; ++cidx) {
+        for (t_uindex cidx : columns) {
             cells.push_back(std::pair<t_index, t_index>(ridx, cidx));
         }
     }
 
     auto cells_info = resolve_cells(cells);
-
-    t_index nrows = ext.m_erow - ext.m_srow;
-    t_index stride = ext.m_ecol - ext.m_scol;
     std::vector<t_tscalar> retval(nrows * stride);
 
     t_tscalar empty = mknone();
+    t_uindex n_aggs = m_config.get_num_aggregates();
 
-    typedef std::pair<t_uindex, t_uindex> t_aggpair;
-    std::map<t_aggpair, const t_column*> aggmap;
-
+    // Aggregate columns, indexed by `treenum * n_aggs + agg_index`
+    std::vector<const t_column*> aggcols(m_trees.size() * n_aggs);
     for (t_uindex treeidx = 0, tree_loop_end = m_trees.size(); treeidx < tree_loop_end;
          ++treeidx) {
         auto aggtable = m_trees[treeidx]->get_aggtable();
-        t_schema aggschema = aggtable->get_schema();
+        const t_schema& aggschema = aggtable->get_schema();
 
-        for (t_uindex aggidx = 0, agg_loop_end = m_config.get_num_aggregates();
-             aggidx < agg_loop_end; ++aggidx) {
+        for (t_uindex aggidx = 0; aggidx < n_aggs; ++aggidx) {
             const std::string& aggname = aggschema.m_columns[aggidx];
-
-            aggmap[t_aggpair(treeidx, aggidx)] = aggtable->get_const_column(aggname).get();
+            aggcols[treeidx * n_aggs + aggidx] = aggtable->get_const_column(aggname).get();
         }
     }
 
     const std::vector<t_aggspec>& aggspecs = m_config.get_aggregates();
 
     for (t_index ridx = ext.m_srow; ridx < ext.m_erow; ++ridx) {
-        if (ext.m_scol == 0) {
-            retval[(ridx - ext.m_srow) * stride].set(
-                rtree()->get_value(m_rtraversal->get_tree_index(ridx)));
-        }
+        for (t_index col = 0; col < stride; ++col) {
+            t_index insert_idx = (ridx - ext.m_srow) * stride + col;
+
+            if (columns[col] == 0) {
+                retval[insert_idx].set(rtree()->get_value(m_rtraversal->get_tree_index(ridx)));
+                continue;
+            }
 
-        for (t_index cidx = std::max(ext.m_scol, t_index(1)); cidx < ext.m_ecol; ++cidx) {
-            t_index insert_idx = (ridx - ext.m_srow) * stride + (cidx - ext.m_scol);
             const t_cellinfo& cinfo = cells_info[insert_idx];
 
             if (cinfo.m_idx < 0) {
                 retval[insert_idx].set(empty);
             } else {
-                auto aggcol = aggmap[t_aggpair(cinfo.m_treenum, cinfo.m_agg_index)];
+                auto aggcol = aggcols[cinfo.m_treenum * n_aggs + cinfo.m_agg_index];
 
                 t_index p_idx = m_trees[cinfo.m_treenum]->get_parent_idx(cinfo.m_idx);
 
@@ -414,17 +431,17 @@ t_ctx2::resolve_cells(const std::vector<std::pair<t_uindex, t_uindex>>& cells) c
     t_index n_aggs = m_config.get_num_aggregates();
     std::vector<t_index> c_tvindices = get_ctraversal_indices();
 
-    std::vector<std::vector<t_tscalar>> col_paths(m_ctraversal->size());
-
-    for (t_index cidx = 0, loop_end = c_tvindices.size(); cidx < loop_end; ++cidx) {
-        auto translated = c_tvindices[cidx];
-        const t_tvnode& c_tvnode = m_ctraversal->get_node(translated);
-        col_paths[cidx].reserve(m_config.get_num_cpivots());
-        col_paths[cidx] = get_column_path(c_tvnode);
-    }
+    // Column paths are only computed for the columns referenced by `cells`,
+    // and row paths once per run of cells in the same row.
+    std::vector<std::vector<t_tscalar>> col_paths(c_tvindices.size());
+    std::vector<bool> has_col_path(c_tvindices.size(), false);
 
     t_uindex ncols = get_num_view_columns();
 
+    t_uindex row_cache_ridx = std::numeric_limits<t_uindex>::max();
+    t_index r_path_ptidx = INVALID_INDEX;
+    bool has_r_path_ptidx = false;
+
     for (t_index idx = 0, loop_end = cells.size(); idx < loop_end; ++idx) {
         const auto& cell = cells[idx];
 
@@ -435,9 +452,13 @@ t_ctx2::resolve_cells(const std::vector<std::pair<t_uindex, t_uindex>>& cells) c
 
         const t_tvnode& r_tvnode = m_rtraversal->get_node(cell.first);
 
+        if (cell.first != row_cache_ridx) {
+            row_cache_ridx = cell.first;
+            has_r_path_ptidx = false;
+        }
+
         t_index r_ptidx = r_tvnode.m_tnid;
         t_depth r_depth = r_tvnode.m_depth;
-        std::vector<t_tscalar> r_path = get_row_path(r_tvnode);
         t_index agg_idx = (cell.second - 1) % n_aggs;
         t_uindex translated_cidx = calc_translated_colidx(n_aggs, cell.second);
         if (translated_cidx >= c_tvindices.size()) {
@@ -457,6 +478,12 @@ t_ctx2::resolve_cells(const std::vector<std::pair<t_uindex, t_uindex>>& cells) c
 
         const t_tvnode& c_tvnode = m_ctraversal->get_node(c_tvidx);
         t_index c_ptidx = c_tvnode.m_tnid;
+
+        if (!has_col_path[translated_cidx]) {
+            col_paths[translated_cidx] = get_column_path(c_tvnode);
+            has_col_path[translated_cidx] = true;
+        }
+
         const std::vector<t_tscalar>& c_path = col_paths[translated_cidx];
 
         rval[idx].m_agg_index = agg_idx;
@@ -474,11 +501,15 @@ t_ctx2::resolve_cells(const std::vector<std::pair<t_uindex, t_uindex>>& cells) c
             if (r_depth + 1 == static_cast<t_depth>(m_trees.size())) {
                 rval[idx].m_idx = m_trees[tree_idx]->resolve_path(r_ptidx, c_path);
             } else {
-                t_index path_ptidx = m_trees[tree_idx]->resolve_path(0, r_path);
-                if (path_ptidx < 0) {
+                if (!has_r_path_ptidx) {
+                    r_path_ptidx = m_trees[tree_idx]->resolve_path(0, get_row_path(r_tvnode));
+                    has_r_path_ptidx = true;
+                }
+
+                if (r_path_ptidx < 0) {
                     rval[idx].m_idx = INVALID_INDEX;
                 } else {
-                    rval[idx].m_idx = m_trees[tree_idx]->resolve_path(path_ptidx, c_path);
+                    rval[idx].m_idx = m_trees[tree_idx]->resolve_path(r_path_ptidx, c_path);
                 }
             }
         }
@@ -522,6 +553,11 @@ t_ctx2::ctree() const {
     return m_trees.front();
 }
 
+t_uindex
+t_ctx2::get_column_version() const {
+    return m_ctraversal->get_version();
+}
+
 t_uindex
 t_ctx2::get_num_view_columns() const {
     switch (m_config.get_totals()) {
@@ -853,6 +889,18 @@ t_ctx2::get_trees() {
     return rval;
 }
 
+void
+t_ctx2::get_memory_usage(t_memory_usage& usage) const {
+    for (const auto& tree : m_trees) {
+        if (tree) {
+            tree->get_memory_usage(usage);
+        }
+    }
+
+    usage["traversal"] += m_rtraversal->get_memory_usage();
+    usage["traversal"] += m_ctraversal->get_memory_usage();
+}
+
 bool
 t_ctx2::has_deltas() const {
     bool has_deltas = false;
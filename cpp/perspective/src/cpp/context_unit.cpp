@@ -403,6 +403,12 @@ t_ctxunit::has_deltas() const {
     return m_has_delta;
 }
 
+void
+t_ctxunit::get_memory_usage(t_memory_usage& usage) const {
+    usage["deltas"] += hash_memory_usage(m_delta_pkeys);
+    usage["symtable"] += m_symtable.get_memory_usage();
+}
+
 t_dtype
 t_ctxunit::get_column_dtype(t_uindex idx) const {
     if (idx >= static_cast<t_uindex>(get_column_count()))
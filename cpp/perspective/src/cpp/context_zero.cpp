@@ -624,6 +624,13 @@ t_ctx0::get_trees() {
     return std::vector<t_stree*>();
 }
 
+void
+t_ctx0::get_memory_usage(t_memory_usage& usage) const {
+    usage["traversal"] += m_traversal->get_memory_usage();
+    usage["deltas"] += node_memory_usage(*m_deltas) + hash_memory_usage(m_delta_pkeys);
+    usage["symtable"] += m_symtable.get_memory_usage();
+}
+
 bool
 t_ctx0::has_deltas() const {
     return m_has_delta;
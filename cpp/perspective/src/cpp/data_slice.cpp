@@ -25,7 +25,8 @@ t_data_slice<CTX_T>::t_data_slice(std::shared_ptr<CTX_T> ctx, t_uindex start_row
     , m_row_offset(row_offset)
     , m_col_offset(col_offset)
     , m_slice(slice)
-    , m_column_names(column_names) {
+    , m_column_names(
+          std::make_shared<const std::vector<std::vector<t_tscalar>>>(column_names)) {
     m_stride = m_end_col - m_start_col;
 }
 
@@ -43,6 +44,26 @@ t_data_slice<CTX_T>::t_data_slice(std::shared_ptr<CTX_T> ctx, t_uindex start_row
     , m_row_offset(row_offset)
     , m_col_offset(col_offset)
     , m_slice(slice)
+    , m_column_names(
+          std::make_shared<const std::vector<std::vector<t_tscalar>>>(column_names))
+    , m_column_indices(column_indices) {
+    m_stride = m_end_col - m_start_col;
+}
+
+template <typename CTX_T>
+t_data_slice<CTX_T>::t_data_slice(std::shared_ptr<CTX_T> ctx, t_uindex start_row,
+    t_uindex end_row, t_uindex start_col, t_uindex end_col, t_uindex row_offset,
+    t_uindex col_offset, const std::vector<t_tscalar>& slice,
+    std::shared_ptr<const std::vector<std::vector<t_tscalar>>> column_names,
+    const std::vector<t_uindex>& column_indices)
+    : m_ctx(ctx)
+    , m_start_row(start_row)
+    , m_end_row(end_row)
+    , m_start_col(start_col)
+    , m_end_col(end_col)
+    , m_row_offset(row_offset)
+    , m_col_offset(col_offset)
+    , m_slice(slice)
     , m_column_names(column_names)
     , m_column_indices(column_indices) {
     m_stride = m_end_col - m_start_col;
@@ -117,7 +138,7 @@ t_data_slice<CTX_T>::get_slice() const {
 template <typename CTX_T>
 const std::vector<std::vector<t_tscalar>>&
 t_data_slice<CTX_T>::get_column_names() const {
-    return m_column_names;
+    return *m_column_names;
 }
 
 template <typename CTX_T>
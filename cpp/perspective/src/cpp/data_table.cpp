@@ -289,6 +289,21 @@ t_data_table::reserve(t_uindex capacity) {
     set_capacity(std::max(capacity, m_capacity));
 }
 
+void
+t_data_table::shrink(t_uindex capacity) {
+    PSP_TRACE_SENTINEL();
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    capacity = std::max(capacity, m_size);
+    if (capacity >= m_capacity) {
+        return;
+    }
+
+    for (t_uindex idx = 0, loop_end = m_columns.size(); idx < loop_end; ++idx) {
+        m_columns[idx]->shrink(capacity);
+    }
+    set_capacity(capacity);
+}
+
 t_column*
 t_data_table::_get_column(const std::string& colname) {
     PSP_TRACE_SENTINEL();
@@ -457,6 +472,43 @@ t_data_table::append(const t_data_table& other) {
     set_size(m_size + other.num_rows());
 }
 
+bool
+t_data_table::swap_columns(t_data_table& other) {
+    PSP_TRACE_SENTINEL();
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+
+    t_uindex ncols = m_schema.m_columns.size();
+    if (other.m_schema.m_columns.size() != ncols) {
+        return false;
+    }
+
+    std::vector<t_uindex> other_idx(ncols);
+    for (t_uindex idx = 0; idx < ncols; ++idx) {
+        const std::string& cname = m_schema.m_columns[idx];
+        if (!other.m_schema.has_column(cname)) {
+            return false;
+        }
+
+        t_uindex oidx = other.m_schema.get_colidx(cname);
+        const auto& col = m_columns[idx];
+        const auto& other_col = other.m_columns[oidx];
+        if (col->get_dtype() != other_col->get_dtype()
+            || col->is_status_enabled() != other_col->is_status_enabled()) {
+            return false;
+        }
+
+        other_idx[idx] = oidx;
+    }
+
+    for (t_uindex idx = 0; idx < ncols; ++idx) {
+        std::swap(m_columns[idx], other.m_columns[other_idx[idx]]);
+    }
+
+    std::swap(m_size, other.m_size);
+    std::swap(m_capacity, other.m_capacity);
+    return true;
+}
+
 void
 t_data_table::clear() {
     PSP_TRACE_SENTINEL();
@@ -544,6 +596,17 @@ t_data_table::get_capacity() const {
     return m_capacity;
 }
 
+t_uindex
+t_data_table::get_memory_usage() const {
+    t_uindex rv = 0;
+    for (const auto& column : m_columns) {
+        if (column) {
+            rv += column->get_memory_usage();
+        }
+    }
+    return rv;
+}
+
 t_data_table*
 t_data_table::clone_(const t_mask& mask) const {
     PSP_TRACE_SENTINEL();
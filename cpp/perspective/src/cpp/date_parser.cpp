@@ -8,6 +8,9 @@
  */
 
 #include <sstream>
+#include <cctype>
+#include <cstring>
+#include <ctime>
 #include <perspective/first.h>
 #include <perspective/date_parser.h>
 #include <locale>
@@ -25,10 +28,399 @@ const std::string t_date_parser::VALID_FORMATS[12]
         "%m-%d-%Y",
         "%m/%d/%Y", "%m-%d-%Y", "%m %d %Y", "%m/%d/%Y", "%m/%d/%y", "%d %m %Y"};
 
+namespace {
+    // Parse exactly `ndigits` decimal digits from `str`, advancing `pos`.
+    bool
+    parse_digits(const char* str, t_uindex len, t_uindex& pos, t_uindex ndigits,
+        std::int32_t& out) {
+        if (pos + ndigits > len) {
+            return false;
+        }
+
+        std::int32_t value = 0;
+        for (t_uindex end = pos + ndigits; pos < end; ++pos) {
+            char c = str[pos];
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            value = value * 10 + (c - '0');
+        }
+
+        out = value;
+        return true;
+    }
+
+    // Days since 1970-01-01 of a proleptic Gregorian date, see
+    // http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+    std::int64_t
+    days_from_civil(std::int64_t y, std::int64_t m, std::int64_t d) {
+        y -= m <= 2;
+        const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+        const std::int64_t yoe = y - era * 400;
+        const std::int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        const std::int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+    }
+
+    bool
+    is_leap_year(std::int32_t year) {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    bool
+    is_valid_date(const t_parsed_datetime& result) {
+        static const std::int32_t DAYS_IN_MONTH[12]
+            = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+        if (result.m_month < 1 || result.m_month > 12 || result.m_day < 1) {
+            return false;
+        }
+
+        std::int32_t month_days = DAYS_IN_MONTH[result.m_month - 1];
+        if (result.m_month == 2 && is_leap_year(result.m_year)) {
+            month_days = 29;
+        }
+
+        return result.m_day <= month_days;
+    }
+
+    // Parse between 1 and `max_digits` decimal digits from `str`, advancing
+    // `pos`, and return the number of digits read.
+    t_uindex
+    parse_number(const char* str, t_uindex len, t_uindex& pos, t_uindex max_digits,
+        std::int32_t& out) {
+        t_uindex start = pos;
+        std::int32_t value = 0;
+        while (pos < len && pos - start < max_digits && str[pos] >= '0' && str[pos] <= '9') {
+            value = value * 10 + (str[pos] - '0');
+            ++pos;
+        }
+
+        out = value;
+        return pos - start;
+    }
+
+    // Match the 3-letter name at `pos` case-insensitively against `names`,
+    // returning its index or -1.
+    std::int32_t
+    parse_name(const char* str, t_uindex len, t_uindex& pos, const char* const* names,
+        std::int32_t nnames) {
+        if (pos + 3 > len) {
+            return -1;
+        }
+
+        for (std::int32_t idx = 0; idx < nnames; ++idx) {
+            const char* name = names[idx];
+            bool match = true;
+            for (t_uindex i = 0; i < 3; ++i) {
+                if (std::tolower(static_cast<unsigned char>(str[pos + i])) != name[i]) {
+                    match = false;
+                    break;
+                }
+            }
+
+            if (match) {
+                pos += 3;
+                return idx;
+            }
+        }
+
+        return -1;
+    }
+
+    // `HH:MM[:SS[.fff]]`
+    bool
+    parse_time(const char* str, t_uindex len, t_uindex& pos, t_parsed_datetime& result) {
+        result.m_has_time = true;
+        if (!parse_digits(str, len, pos, 2, result.m_hour) || pos >= len || str[pos++] != ':'
+            || !parse_digits(str, len, pos, 2, result.m_minute)) {
+            return false;
+        }
+
+        if (pos < len && str[pos] == ':') {
+            ++pos;
+            if (!parse_digits(str, len, pos, 2, result.m_second)) {
+                return false;
+            }
+
+            // Fractional seconds beyond millisecond precision are truncated.
+            if (pos < len && (str[pos] == '.' || str[pos] == ',')) {
+                ++pos;
+                t_uindex start = pos;
+                std::int32_t scale = 100;
+                while (pos < len && str[pos] >= '0' && str[pos] <= '9') {
+                    result.m_millisecond += (str[pos] - '0') * scale;
+                    scale /= 10;
+                    ++pos;
+                }
+
+                if (pos == start) {
+                    return false;
+                }
+            }
+        }
+
+        // Leap seconds are rejected, as by `datetime` - see `time.h`.
+        return result.m_hour <= 23 && result.m_minute <= 59 && result.m_second <= 59;
+    }
+
+    // `Z` or `+HH[[:]MM]`, and with `allow_names` also `UT`, `UTC` and `GMT`.
+    bool
+    parse_tz_designator(const char* str, t_uindex len, t_uindex& pos,
+        t_parsed_datetime& result, bool allow_names) {
+        result.m_has_tz_offset = true;
+        result.m_tz_offset = 0;
+
+        if (allow_names) {
+            static const char* const NAMES[3] = {"UTC", "GMT", "UT"};
+            for (const char* name : NAMES) {
+                t_uindex name_len = std::strlen(name);
+                if (len - pos == name_len && std::strncmp(str + pos, name, name_len) == 0) {
+                    pos = len;
+                    return true;
+                }
+            }
+        }
+
+        char designator = str[pos++];
+        if (designator == 'Z' || designator == 'z') {
+            return true;
+        } else if (designator == '+' || designator == '-') {
+            std::int32_t tz_hour = 0;
+            std::int32_t tz_minute = 0;
+            if (!parse_digits(str, len, pos, 2, tz_hour)) {
+                return false;
+            }
+
+            // Minutes are optional, but required after a `:`.
+            if (pos < len) {
+                if (str[pos] == ':') {
+                    ++pos;
+                }
+
+                if (!parse_digits(str, len, pos, 2, tz_minute)) {
+                    return false;
+                }
+            }
+
+            if (tz_hour > 23 || tz_minute > 59) {
+                return false;
+            }
+
+            result.m_tz_offset = tz_hour * 60 + tz_minute;
+            if (designator == '-') {
+                result.m_tz_offset = -result.m_tz_offset;
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+} // namespace
+
+t_parsed_datetime::t_parsed_datetime()
+    : m_year(1970)
+    , m_month(1)
+    , m_day(1)
+    , m_hour(0)
+    , m_minute(0)
+    , m_second(0)
+    , m_millisecond(0)
+    , m_tz_offset(0)
+    , m_has_time(false)
+    , m_has_tz_offset(false) {}
+
+std::int64_t
+t_parsed_datetime::to_epoch_ms() const {
+    std::int64_t days = days_from_civil(m_year, m_month, m_day);
+    std::int64_t seconds = days * 86400 + m_hour * 3600 + m_minute * 60 + m_second
+        - static_cast<std::int64_t>(m_tz_offset) * 60;
+    return seconds * 1000 + m_millisecond;
+}
+
+bool
+t_parsed_datetime::to_local_epoch_ms(std::int64_t& out) const {
+    if (m_has_tz_offset) {
+        out = to_epoch_ms();
+        return true;
+    }
+
+    std::tm tm = {};
+    tm.tm_year = m_year - 1900;
+    tm.tm_mon = m_month - 1;
+    tm.tm_mday = m_day;
+    tm.tm_hour = m_hour;
+    tm.tm_min = m_minute;
+    tm.tm_sec = m_second;
+    tm.tm_isdst = -1; // let std::mktime decide whether DST is in effect
+
+    std::time_t seconds = std::mktime(&tm);
+    if (seconds == -1) {
+        return false;
+    }
+
+    out = static_cast<std::int64_t>(seconds) * 1000 + m_millisecond;
+    return true;
+}
+
 t_date_parser::t_date_parser() {}
 
+bool
+t_date_parser::parse(const char* str, t_uindex len, t_parsed_datetime& out) const {
+    t_uindex pos = 0;
+    t_parsed_datetime result;
+
+    if (!parse_digits(str, len, pos, 4, result.m_year) || pos >= len || str[pos++] != '-'
+        || !parse_digits(str, len, pos, 2, result.m_month) || pos >= len
+        || str[pos++] != '-' || !parse_digits(str, len, pos, 2, result.m_day)) {
+        return false;
+    }
+
+    if (!is_valid_date(result)) {
+        return false;
+    }
+
+    if (pos < len) {
+        if (str[pos] != 'T' && str[pos] != ' ') {
+            return false;
+        }
+
+        ++pos;
+        if (!parse_time(str, len, pos, result)) {
+            return false;
+        }
+
+        if (pos < len && !parse_tz_designator(str, len, pos, result, false)) {
+            return false;
+        }
+    }
+
+    if (pos != len) {
+        return false;
+    }
+
+    out = result;
+    return true;
+}
+
+bool
+t_date_parser::parse_extended(const char* str, t_uindex len, t_parsed_datetime& out) const {
+    static const char* const MONTHS[12]
+        = {"jan", "feb", "mar", "apr", "may", "jun", "jul", "aug", "sep", "oct", "nov", "dec"};
+    static const char* const WEEKDAYS[7] = {"mon", "tue", "wed", "thu", "fri", "sat", "sun"};
+
+    if (parse(str, len, out)) {
+        return true;
+    }
+
+    t_uindex pos = 0;
+    t_parsed_datetime result;
+    bool year_first = false;
+
+    // RFC-2822 dates may start with the day of the week, i.e. `Thu, `.
+    bool rfc2822 = parse_name(str, len, pos, WEEKDAYS, 7) != -1;
+    if (rfc2822) {
+        if (pos < len && str[pos] == ',') {
+            ++pos;
+        }
+
+        if (pos >= len || str[pos++] != ' ') {
+            return false;
+        }
+    }
+
+    std::int32_t first = 0;
+    t_uindex first_digits = parse_number(str, len, pos, 4, first);
+    if (first_digits == 0) {
+        return false;
+    }
+
+    if (rfc2822 || (first_digits <= 2 && pos < len && str[pos] == ' ')) {
+        // `D Mon YYYY`
+        result.m_day = first;
+        if (first_digits > 2 || pos >= len || str[pos++] != ' ') {
+            return false;
+        }
+
+        std::int32_t month = parse_name(str, len, pos, MONTHS, 12);
+        if (month == -1 || pos >= len || str[pos++] != ' '
+            || !parse_digits(str, len, pos, 4, result.m_year)) {
+            return false;
+        }
+
+        result.m_month = month + 1;
+    } else {
+        // `YYYY/M/D` or `M/D/YYYY`, with a consistent separator.
+        char separator = pos < len ? str[pos++] : '\0';
+        if (separator != '/' && separator != '-' && separator != '.') {
+            return false;
+        }
+
+        std::int32_t second = 0;
+        if (parse_number(str, len, pos, 2, second) == 0 || pos >= len
+            || str[pos++] != separator) {
+            return false;
+        }
+
+        if (first_digits == 4) {
+            year_first = true;
+            result.m_year = first;
+            result.m_month = second;
+            if (parse_number(str, len, pos, 2, result.m_day) == 0) {
+                return false;
+            }
+        } else if (first_digits <= 2) {
+            result.m_month = first;
+            result.m_day = second;
+            if (!parse_digits(str, len, pos, 4, result.m_year)) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+
+    if (result.m_year < 1 || !is_valid_date(result)) {
+        return false;
+    }
+
+    if (pos < len) {
+        if (str[pos] != ' ' && !(year_first && str[pos] == 'T')) {
+            return false;
+        }
+
+        ++pos;
+        if (!parse_time(str, len, pos, result)) {
+            return false;
+        }
+
+        if (pos < len) {
+            if (str[pos] == ' ') {
+                ++pos;
+            }
+
+            if (pos >= len || !parse_tz_designator(str, len, pos, result, true)) {
+                return false;
+            }
+        }
+    }
+
+    if (pos != len) {
+        return false;
+    }
+
+    out = result;
+    return true;
+}
+
 bool
 t_date_parser::is_valid(std::string const& datestring) {
+    t_parsed_datetime parsed;
+    if (parse(datestring.c_str(), datestring.size(), parsed)) {
+        return true;
+    }
+
     for (const std::string& fmt : VALID_FORMATS) {
         if (fmt != "") {
             std::tm t = {};
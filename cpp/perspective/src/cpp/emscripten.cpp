@@ -9,6 +9,7 @@
 
 #include <perspective/emscripten.h>
 #include <perspective/arrow_loader.h>
+#include <perspective/json_loader.h>
 #include <perspective/arrow_writer.h>
 #include <arrow/csv/api.h>
 
@@ -71,8 +72,11 @@ namespace binding {
         } else {
             return false;
         }
-        tm local_tm = *localtime(&tt);
-        (*out) = t_date(local_tm.tm_year + 1900, local_tm.tm_mon, local_tm.tm_mday);
+        std::tm t;
+        if (!local_tm(tt, t)) {
+            return false;
+        }
+        (*out) = t_date(t.tm_year + 1900, t.tm_mon, t.tm_mday);
         return true;
     }
 
@@ -205,8 +209,7 @@ namespace binding {
     t_val
     get_row_delta(
         std::shared_ptr<View<CTX_T>> view) {
-        auto slice = view->get_row_delta();
-        auto row_delta = view->data_slice_to_arrow(slice);
+        auto row_delta = view->get_row_delta_arrow();
         return str_to_arraybuffer(row_delta)["buffer"];
     }
     
@@ -1068,6 +1071,7 @@ namespace binding {
         bool is_update,
         bool is_arrow,
         bool is_csv,
+        bool is_json,
         t_uindex port_id) {
         bool table_initialized = has_value(table);
         std::shared_ptr<t_pool> pool;
@@ -1087,6 +1091,7 @@ namespace binding {
         std::vector<std::string> column_names;
         std::vector<t_dtype> data_types;
         apachearrow::ArrowLoader arrow_loader;
+        json::JsonLoader json_loader;
         std::uintptr_t ptr;
 
         // Determine metadata
@@ -1163,6 +1168,11 @@ namespace binding {
 
                 // Parse the arrow and get its metadata
                 arrow_loader.initialize(ptr, length);
+
+                // `ptr` is freed with the last column that points into it,
+                // which may be after the update has been processed.
+                arrow_loader.set_zero_copy(
+                    std::shared_ptr<void>(reinterpret_cast<void*>(ptr), free));
             }
             
             // Always use the `Table` column names and data types on up
@@ -1212,6 +1222,18 @@ namespace binding {
                 column_names = arrow_loader.names();
                 data_types = arrow_loader.types();
             }
+        } else if (is_json && !is_delete) {
+            json_loader.initialize(accessor.as<std::string>());
+
+            // Always use the `Table` column names and data types on update.
+            if (table_initialized && is_update) {
+                auto schema = gnode->get_output_schema().drop({"psp_okey"});
+                column_names = schema.columns();
+                data_types = schema.types();
+            } else {
+                column_names = json_loader.names();
+                data_types = json_loader.types();
+            }
         } else if (is_update || is_delete) {
             t_val names = accessor["names"];
             t_val types = accessor["types"];
@@ -1255,6 +1277,8 @@ namespace binding {
         std::uint32_t row_count = 0;
         if (is_arrow) {
             row_count = arrow_loader.row_count();
+        } else if (is_json) {
+            row_count = json_loader.row_count();
         } else {
             row_count = accessor["row_count"].as<std::int32_t>();
         }
@@ -1265,16 +1289,15 @@ namespace binding {
 
         if (is_arrow) {
             arrow_loader.fill_table(data_table, input_schema, index, offset, limit, is_update);
+        } else if (is_json) {
+            json_loader.fill_table(data_table, input_schema, index, offset, limit, is_update);
         } else {
             _fill_data(data_table, accessor, input_schema, index, offset, limit, is_update);
         }
 
-        if (is_arrow && !is_csv) {
-            free((void *)ptr);
-        }
-
         // calculate offset, limit, and set the gnode
         tbl->init(data_table, row_count, op, port_id);
+
         return tbl;
     }
 
@@ -1534,6 +1557,12 @@ namespace binding {
     std::shared_ptr<t_ctxunit>
     make_context(std::shared_ptr<Table> table, std::shared_ptr<t_schema> schema,
         std::shared_ptr<t_view_config> view_config, const std::string& name) {
+        auto key = std::to_string(UNIT_CONTEXT) + view_config->get_context_key();
+        auto shared_ctx = table->acquire_context<t_ctxunit>(key);
+        if (shared_ctx) {
+            return shared_ctx;
+        }
+
         auto columns = view_config->get_columns();
         auto filter_op = view_config->get_filter_op();
         auto fterm = view_config->get_fterm();
@@ -1551,6 +1580,7 @@ namespace binding {
             name,
             UNIT_CONTEXT,
             reinterpret_cast<std::uintptr_t>(ctx_unit.get()));
+        table->share_context(key, name, ctx_unit);
 
         return ctx_unit;
     }
@@ -1559,6 +1589,12 @@ namespace binding {
     std::shared_ptr<t_ctx0>
     make_context(std::shared_ptr<Table> table, std::shared_ptr<t_schema> schema,
         std::shared_ptr<t_view_config> view_config, const std::string& name) {
+        auto key = std::to_string(ZERO_SIDED_CONTEXT) + view_config->get_context_key();
+        auto shared_ctx = table->acquire_context<t_ctx0>(key);
+        if (shared_ctx) {
+            return shared_ctx;
+        }
+
         auto columns = view_config->get_columns();
         auto filter_op = view_config->get_filter_op();
         auto fterm = view_config->get_fterm();
@@ -1574,6 +1610,7 @@ namespace binding {
         auto gnode = table->get_gnode();
         pool->register_context(gnode->get_id(), name, ZERO_SIDED_CONTEXT,
             reinterpret_cast<std::uintptr_t>(ctx0.get()));
+        table->share_context(key, name, ctx0);
 
         return ctx0;
     }
@@ -1791,6 +1828,7 @@ EMSCRIPTEN_BINDINGS(perspective) {
             const std::string&>()
         .smart_ptr<std::shared_ptr<Table>>("shared_ptr<Table>")
         .function("size", &Table::size)
+        .function("get_memory_usage", &Table::get_memory_usage)
         .function("get_schema", &Table::get_schema)
         .function("get_computed_schema", &Table::get_computed_schema)
         .function("unregister_gnode", &Table::unregister_gnode)
@@ -1831,6 +1869,7 @@ EMSCRIPTEN_BINDINGS(perspective) {
         .function("get_filter", &View<t_ctxunit>::get_filter)
         .function("get_sort", &View<t_ctxunit>::get_sort)
         .function("get_step_delta", &View<t_ctxunit>::get_step_delta)
+        .function("get_memory_usage", &View<t_ctxunit>::get_memory_usage)
         .function("get_column_dtype", &View<t_ctxunit>::get_column_dtype)
         .function("is_column_only", &View<t_ctxunit>::is_column_only);
 
@@ -1859,6 +1898,7 @@ EMSCRIPTEN_BINDINGS(perspective) {
         .function("get_filter", &View<t_ctx0>::get_filter)
         .function("get_sort", &View<t_ctx0>::get_sort)
         .function("get_step_delta", &View<t_ctx0>::get_step_delta)
+        .function("get_memory_usage", &View<t_ctx0>::get_memory_usage)
         .function("get_column_dtype", &View<t_ctx0>::get_column_dtype)
         .function("is_column_only", &View<t_ctx0>::is_column_only);
 
@@ -1890,6 +1930,7 @@ EMSCRIPTEN_BINDINGS(perspective) {
         .function("get_filter", &View<t_ctx1>::get_filter)
         .function("get_sort", &View<t_ctx1>::get_sort)
         .function("get_step_delta", &View<t_ctx1>::get_step_delta)
+        .function("get_memory_usage", &View<t_ctx1>::get_memory_usage)
         .function("get_column_dtype", &View<t_ctx1>::get_column_dtype)
         .function("is_column_only", &View<t_ctx1>::is_column_only);
 
@@ -1922,6 +1963,7 @@ EMSCRIPTEN_BINDINGS(perspective) {
         .function("get_sort", &View<t_ctx2>::get_sort)
         .function("get_row_path", &View<t_ctx2>::get_row_path)
         .function("get_step_delta", &View<t_ctx2>::get_step_delta)
+        .function("get_memory_usage", &View<t_ctx2>::get_memory_usage)
         .function("get_column_dtype", &View<t_ctx2>::get_column_dtype)
         .function("is_column_only", &View<t_ctx2>::is_column_only);
 
@@ -2046,7 +2088,25 @@ EMSCRIPTEN_BINDINGS(perspective) {
         .smart_ptr<std::shared_ptr<t_pool>>("shared_ptr<t_pool>")
         .function("unregister_gnode", &t_pool::unregister_gnode)
         .function("_process", &t_pool::_process)
-        .function("set_update_delegate", &t_pool::set_update_delegate);
+        .function("set_update_delegate", &t_pool::set_update_delegate)
+        .function("set_shrink_policy", &t_pool::set_shrink_policy)
+        .function("get_metrics", &t_pool::get_metrics);
+
+    value_object<t_shrink_policy>("t_shrink_policy")
+        .field("min_updates", &t_shrink_policy::m_min_updates)
+        .field("ratio", &t_shrink_policy::m_ratio)
+        .field("min_rows", &t_shrink_policy::m_min_rows)
+        .field("shrink_master", &t_shrink_policy::m_shrink_master);
+
+    class_<t_metrics>("t_metrics")
+        .smart_ptr<std::shared_ptr<t_metrics>>("shared_ptr<t_metrics>")
+        .function("set_enabled", &t_metrics::set_enabled)
+        .function("is_enabled", &t_metrics::is_enabled)
+        .function("set_tracing", &t_metrics::set_tracing)
+        .function("is_tracing", &t_metrics::is_tracing)
+        .function("to_json", &t_metrics::to_json)
+        .function("to_chrome_trace", &t_metrics::to_chrome_trace)
+        .function("reset", &t_metrics::reset);
 
     /******************************************************************************
      *
@@ -2106,6 +2166,7 @@ EMSCRIPTEN_BINDINGS(perspective) {
         "std::map<std::string, std::string>");
     register_map<std::string, std::map<std::string, std::string>>(
         "std::map<std::string, std::map<std::string, std::string>>");
+    register_map<std::string, t_uindex>("std::map<std::string, t_uindex>");
 
     /******************************************************************************
      *
@@ -2227,4 +2288,5 @@ EMSCRIPTEN_BINDINGS(perspective) {
     function("get_table_computed_schema", &get_table_computed_schema<t_val>);
     function("get_computation_input_types", &get_computation_input_types);
     function("is_valid_datetime", &is_valid_datetime);
+    function("get_interned_memory_usage", &get_interned_memory_usage);
 }
@@ -139,22 +139,63 @@ t_ftrav::sort_by(std::shared_ptr<const t_gstate> gstate, const t_config& config,
     const std::vector<t_sortspec>& sortby) {
     if (sortby.empty())
         return;
-    t_multisorter sorter(get_sort_orders(sortby));
-    t_index size = m_index->size();
-    auto sort_elems = std::make_shared<std::vector<t_mselem>>(static_cast<size_t>(size));
     m_sortby = sortby;
 
-    for (t_index idx = 0; idx < size; ++idx) {
-        t_mselem& elem = (*sort_elems)[idx];
-        t_tscalar pkey = (*m_index)[idx].m_pkey;
-        fill_sort_elem(gstate, config, pkey, elem);
+    // Resolve the sort columns and each row once, rather than per cell.
+    std::shared_ptr<const t_data_table> table = gstate->get_table();
+    std::vector<std::shared_ptr<const t_column>> columns;
+    columns.reserve(m_sortby.size());
+    for (const t_sortspec& sort : m_sortby) {
+        std::string colname;
+        if (sort.m_colname != "") {
+            colname = config.get_sort_by(sort.m_colname);
+        } else {
+            colname = config.col_at(sort.m_agg_index);
+        }
+        columns.push_back(table->get_const_column(config.get_sort_by(colname)));
+    }
+
+    // Refill the sort values of the existing index in place, reusing the
+    // storage of each row.
+    std::vector<t_mselem>& index = *m_index;
+    for (t_mselem& elem : index) {
+        t_rlookup lookup = gstate->lookup(elem.m_pkey);
+        elem.m_row.clear();
+        elem.m_row.reserve(columns.size());
+        elem.m_order = 0;
+        elem.m_deleted = false;
+        elem.m_updated = false;
+        for (const auto& column : columns) {
+            elem.m_row.push_back(lookup.m_exists
+                    ? m_symtable.get_interned_tscalar(column->get_scalar(lookup.m_idx))
+                    : t_tscalar());
+        }
+    }
+
+    std::vector<t_uindex> order = multisort_indices(index, get_sort_orders(sortby));
+
+    // Apply the permutation by following its cycles, so that slot `idx`
+    // receives the element at `order[idx]`.
+    for (t_uindex idx = 0, loop_end = order.size(); idx < loop_end; ++idx) {
+        if (order[idx] == idx)
+            continue;
+
+        t_mselem displaced(std::move(index[idx]));
+        t_uindex dest = idx;
+        while (order[dest] != idx) {
+            t_uindex src = order[dest];
+            index[dest] = std::move(index[src]);
+            order[dest] = dest;
+            dest = src;
+        }
+
+        index[dest] = std::move(displaced);
+        order[dest] = dest;
     }
 
-    std::swap(m_index, sort_elems);
-    std::sort(m_index->begin(), m_index->end(), sorter);
     m_pkeyidx.clear();
-    for (t_index idx = 0, loop_end = m_index->size(); idx < loop_end; ++idx) {
-        m_pkeyidx[(*m_index)[idx].m_pkey] = idx;
+    for (t_index idx = 0, loop_end = index.size(); idx < loop_end; ++idx) {
+        m_pkeyidx[index[idx].m_pkey] = idx;
     }
 }
 
@@ -163,6 +204,22 @@ t_ftrav::size() const {
     return m_index->size();
 }
 
+t_uindex
+t_ftrav::get_memory_usage() const {
+    t_uindex rv = vector_memory_usage(*m_index) + hash_memory_usage(m_pkeyidx)
+        + hash_memory_usage(m_new_elems) + m_symtable.get_memory_usage();
+
+    for (const t_mselem& elem : *m_index) {
+        rv += vector_memory_usage(elem.m_row);
+    }
+
+    for (const auto& kv : m_new_elems) {
+        rv += vector_memory_usage(kv.second.m_row);
+    }
+
+    return rv;
+}
+
 void
 t_ftrav::get_row_indices(const tsl::hopscotch_set<t_tscalar>& pkeys,
     tsl::hopscotch_map<t_tscalar, t_index>& out_map) const {
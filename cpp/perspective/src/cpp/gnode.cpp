@@ -44,6 +44,25 @@ calc_negate(t_tscalar val) {
     return val.negate();
 }
 
+t_batch_policy::t_batch_policy()
+    : m_max_latency_ms(0)
+    , m_max_rows(0)
+    , m_max_bytes(0) {}
+
+t_batch_stats::t_batch_stats()
+    : m_num_batches(0)
+    , m_num_rows(0)
+    , m_last_rows(0)
+    , m_max_rows(0)
+    , m_last_latency_ms(0)
+    , m_max_latency_ms(0) {}
+
+t_shrink_policy::t_shrink_policy()
+    : m_min_updates(16)
+    , m_ratio(4)
+    , m_min_rows(1024)
+    , m_shrink_master(false) {}
+
 t_gnode::t_gnode(const t_schema& input_schema, const t_schema& output_schema)
     : m_mode(NODE_PROCESSING_SIMPLE_DATAFLOW)
     , m_gnode_type(GNODE_TYPE_PKEYED)
@@ -68,6 +87,15 @@ t_gnode::t_gnode(const t_schema& input_schema, const t_schema& output_schema)
     m_transitional_schemas = std::vector<t_schema>{
         m_input_schema, m_output_schema, m_output_schema, m_output_schema, trans_schema, existed_schema};
     m_epoch = std::chrono::high_resolution_clock::now();
+
+    // Each column stores a value and a status byte per row
+    m_input_row_bytes = 0;
+    for (auto dtype : m_input_schema.types()) {
+        m_input_row_bytes += get_dtype_size(dtype) + 1;
+    }
+
+    m_shrink_small_updates = 0;
+    m_shrink_recent_rows = 0;
 }
 
 t_gnode::~t_gnode() {
@@ -141,6 +169,7 @@ t_gnode::remove_input_port(t_uindex port_id) {
 
     // remove from the map
     m_input_ports.erase(port_id);
+    m_pending_since.erase(port_id);
 }
 
 t_value_transition
@@ -263,20 +292,26 @@ t_gnode::_process_table(t_uindex port_id) {
     }
 
     m_was_updated = true;
-    flattened = input_port->get_table()->flatten();
+    t_metrics* metrics = m_metrics.get();
+
+    {
+        t_metrics_timer timer(metrics, m_metrics_prefix, "flatten");
+        flattened = input_port->get_table()->flatten();
+    }
 
     PSP_GNODE_VERIFY_TABLE(flattened);
     PSP_GNODE_VERIFY_TABLE(get_table());
 
     t_uindex flattened_num_rows = flattened->num_rows();
 
-    std::vector<t_rlookup> row_lookup(flattened_num_rows);
-    t_column* pkey_col = flattened->get_column("psp_pkey").get();
-    
-    for (t_uindex idx = 0; idx < flattened_num_rows; ++idx) {
-        // See if each primary key in flattened already exist in the dataset
-        t_tscalar pkey = pkey_col->get_scalar(idx);
-        row_lookup[idx] = m_gstate->lookup(pkey);
+    // See if each primary key in flattened already exists in the dataset.
+    // The lookup is shared with `update_master_table`, so each pkey is only
+    // resolved against the master table once per update.
+    std::vector<t_rlookup> row_lookup;
+    {
+        t_metrics_timer timer(metrics, m_metrics_prefix, "lookup");
+        t_column* pkey_col = flattened->get_column("psp_pkey").get();
+        m_gstate->lookup(pkey_col, flattened_num_rows, row_lookup);
     }
 
     // first update - master table is empty
@@ -284,15 +319,24 @@ t_gnode::_process_table(t_uindex port_id) {
         // Compute columns here on the flattened table, as the flattened table
         // does not have any of the computed columns that are stored on the
         // gnode, i.e. from all created contexts.
-        _compute_all_columns({flattened});
+        {
+            t_metrics_timer timer(metrics, m_metrics_prefix, "compute_columns");
+            _compute_all_columns({flattened});
+        }
 
-        m_gstate->update_master_table(flattened.get());
+        {
+            t_metrics_timer timer(metrics, m_metrics_prefix, "update_master_table");
+            m_gstate->update_master_table(flattened.get(), row_lookup);
+        }
 
         m_oports[PSP_PORT_FLATTENED]->set_table(flattened);
 
         // Update context from state after gnode state has been updated, as
         // contexts obliquely read gnode state at various points.
-        _update_contexts_from_state(flattened);
+        {
+            t_metrics_timer timer(metrics, m_metrics_prefix, "update_contexts_from_state");
+            _update_contexts_from_state(flattened);
+        }
 
         input_port->release();
         release_outputs();
@@ -313,7 +357,7 @@ t_gnode::_process_table(t_uindex port_id) {
 
     _process_state.m_state_data_table = get_table_sptr();
     _process_state.m_flattened_data_table = flattened;
-    _process_state.m_lookup = row_lookup;
+    _process_state.m_lookup = std::move(row_lookup);
 
     // Get data tables for process state
     _process_state.m_delta_data_table = m_oports[PSP_PORT_DELTA]->get_table();
@@ -321,7 +365,11 @@ t_gnode::_process_table(t_uindex port_id) {
     _process_state.m_current_data_table = m_oports[PSP_PORT_CURRENT]->get_table();
     _process_state.m_transitions_data_table = m_oports[PSP_PORT_TRANSITIONS]->get_table();
     _process_state.m_existed_data_table = m_oports[PSP_PORT_EXISTED]->get_table();
-    
+
+    // Timed through to the end of the column loop below.
+    std::unique_ptr<t_metrics_timer> compute_timer(
+        new t_metrics_timer(metrics, m_metrics_prefix, "compute_columns"));
+
     // Add computed columns to transitions_data_table
     _add_all_computed_columns(
         _process_state.m_transitions_data_table,
@@ -335,6 +383,7 @@ t_gnode::_process_table(t_uindex port_id) {
 
     // Clear delta, prev, current, transitions, existed on EACH call.
     _process_state.clear_transitional_data_tables();
+    _shrink_tables(flattened_num_rows);
 
     // compute values on transitional tables before reserve
     _compute_all_columns(
@@ -346,8 +395,13 @@ t_gnode::_process_table(t_uindex port_id) {
 
     // And re-reserved for the amount of data in `flattened`
     _process_state.reserve_transitional_data_tables(flattened_num_rows);
+    compute_timer.reset();
 
-    t_mask existed_mask = _process_mask_existed_rows(_process_state);
+    t_mask existed_mask;
+    {
+        t_metrics_timer timer(metrics, m_metrics_prefix, "mask_existed_rows");
+        existed_mask = _process_mask_existed_rows(_process_state);
+    }
     auto mask_count = existed_mask.count();
 
     // mask_count = flattened_num_rows - number of rows that were removed
@@ -371,6 +425,7 @@ t_gnode::_process_table(t_uindex port_id) {
         valid_computed_columns.end());
 
     t_uindex ncols = column_names.size();
+    compute_timer.reset(new t_metrics_timer(metrics, m_metrics_prefix, "process_columns"));
 
 #ifdef PSP_PARALLEL_FOR
     tbb::parallel_for(0, int(ncols), 1,
@@ -441,13 +496,17 @@ t_gnode::_process_table(t_uindex port_id) {
 #ifdef PSP_PARALLEL_FOR
     );
 #endif
-    // After transitional tables are written, compute their values
+
+    // After transitional tables are written, compute their values. This is
+    // timed as part of `process_columns`, so `compute_columns` is recorded
+    // once per update.
     _compute_all_columns(
         {
             _process_state.m_delta_data_table,
             _process_state.m_prev_data_table,
             _process_state.m_current_data_table
         });
+    compute_timer.reset();
 
     /**
      * After all columns have been processed (transitional tables written into),
@@ -460,12 +519,22 @@ t_gnode::_process_table(t_uindex port_id) {
      * new `t_data_table` with the deleted rows masked out.
      */
     std::shared_ptr<t_data_table> flattened_masked;
+    std::vector<t_rlookup> masked_lookup;
 
     if (existed_mask.count() == _process_state.m_flattened_data_table->size()) {
         flattened_masked = _process_state.m_flattened_data_table;
+        masked_lookup = std::move(_process_state.m_lookup);
     } else {
         flattened_masked = 
             _process_state.m_flattened_data_table->clone(existed_mask);
+
+        // Keep the row lookup aligned with the rows of `flattened_masked`
+        masked_lookup.reserve(mask_count);
+        for (t_uindex idx = 0; idx < flattened_num_rows; ++idx) {
+            if (existed_mask.get(idx)) {
+                masked_lookup.push_back(_process_state.m_lookup[idx]);
+            }
+        }
     }
 
     PSP_GNODE_VERIFY_TABLE(flattened_masked);
@@ -477,7 +546,10 @@ t_gnode::_process_table(t_uindex port_id) {
     }
     #endif
 
-    m_gstate->update_master_table(flattened_masked.get());
+    {
+        t_metrics_timer timer(metrics, m_metrics_prefix, "update_master_table");
+        m_gstate->update_master_table(flattened_masked.get(), masked_lookup);
+    }
 
     #ifdef PSP_GNODE_VERIFY
     {
@@ -506,6 +578,31 @@ t_gnode::_process_column<std::string>(
     const t_process_state& process_state) {
     pcolumn->borrow_vocabulary(*scolumn);
 
+    // Translate each distinct vocab id of `fcolumn` once, into the id of the
+    // same string in `scolumn` (to compare against previous values) and in
+    // `ccolumn` (to write current values), so rows only compare and copy ids.
+    const t_uindex unresolved = std::numeric_limits<t_uindex>::max();
+    const t_uindex missing = unresolved - 1;
+    t_uindex fvocab_size = fcolumn->get_vlenidx();
+    std::vector<t_uindex> state_ids(fvocab_size, unresolved);
+    std::vector<t_uindex> current_ids(fvocab_size, unresolved);
+
+    auto get_state_id = [&](t_uindex fid) {
+        if (state_ids[fid] == unresolved) {
+            t_uindex sid;
+            bool found = scolumn->string_exists(fcolumn->unintern_c(fid), sid);
+            state_ids[fid] = found ? sid : missing;
+        }
+        return state_ids[fid];
+    };
+
+    auto get_current_id = [&](t_uindex fid) {
+        if (current_ids[fid] == unresolved) {
+            current_ids[fid] = ccolumn->get_interned(fcolumn->unintern_c(fid));
+        }
+        return current_ids[fid];
+    };
+
     for (t_uindex idx = 0, loop_end = fcolumn->size(); idx < loop_end; ++idx) {
         std::uint8_t op_ = process_state.m_op_base[idx];
         t_op op = static_cast<t_op>(op_);
@@ -519,40 +616,38 @@ t_gnode::_process_column<std::string>(
             case OP_INSERT: {
                 row_pre_existed = row_pre_existed && !prev_pkey_eq;
 
-                const char* prev_value = 0;
+                t_uindex prev_id = 0;
                 bool prev_valid = false;
 
-                auto cur_value = fcolumn->get_nth<const char>(idx);
-                std::string curs(cur_value);
-
+                t_uindex cur_fid = *(fcolumn->get_nth<t_uindex>(idx));
                 bool cur_valid = fcolumn->is_valid(idx);
 
                 if (row_pre_existed) {
-                    prev_value = scolumn->get_nth<const char>(rlookup.m_idx);
+                    prev_id = *(scolumn->get_nth<t_uindex>(rlookup.m_idx));
                     prev_valid = scolumn->is_valid(rlookup.m_idx);
                 }
 
                 bool exists = cur_valid;
                 bool prev_existed = row_pre_existed && prev_valid;
+                // Null cells hold id 0, which need not be in `fcolumn`'s vocab.
                 bool prev_cur_eq
-                    = prev_value && cur_value && strcmp(prev_value, cur_value) == 0;
+                    = row_pre_existed && cur_valid && get_state_id(cur_fid) == prev_id;
 
                 auto trans = calc_transition(prev_existed, row_pre_existed, exists, prev_valid,
                     cur_valid, prev_cur_eq, prev_pkey_eq);
 
                 if (prev_valid) {
-                    pcolumn->set_nth<t_uindex>(
-                        added_count, *(scolumn->get_nth<t_uindex>(rlookup.m_idx)));
+                    pcolumn->set_nth<t_uindex>(added_count, prev_id);
                 }
 
                 pcolumn->set_valid(added_count, prev_valid);
 
                 if (cur_valid) {
-                    ccolumn->set_nth<const char*>(added_count, cur_value);
+                    ccolumn->set_nth<t_uindex>(added_count, get_current_id(cur_fid));
                 }
 
                 if (!cur_valid && prev_valid) {
-                    ccolumn->set_nth<const char*>(added_count, prev_value);
+                    ccolumn->set_nth<const char*>(added_count, scolumn->unintern_c(prev_id));
                 }
 
                 ccolumn->set_valid(added_count, cur_valid ? cur_valid : prev_valid);
@@ -561,15 +656,15 @@ t_gnode::_process_column<std::string>(
             } break;
             case OP_DELETE: {
                 if (row_pre_existed) {
-                    auto prev_value = scolumn->get_nth<const char>(rlookup.m_idx);
+                    t_uindex prev_id = *(scolumn->get_nth<t_uindex>(rlookup.m_idx));
 
                     bool prev_valid = scolumn->is_valid(rlookup.m_idx);
 
-                    pcolumn->set_nth<const char*>(added_count, prev_value);
+                    pcolumn->set_nth<t_uindex>(added_count, prev_id);
 
                     pcolumn->set_valid(added_count, prev_valid);
 
-                    ccolumn->set_nth<const char*>(added_count, prev_value);
+                    ccolumn->set_nth<const char*>(added_count, scolumn->unintern_c(prev_id));
 
                     ccolumn->set_valid(added_count, prev_valid);
 
@@ -584,15 +679,37 @@ t_gnode::_process_column<std::string>(
 void
 t_gnode::send(t_uindex port_id, const t_data_table& fragments) {
     PSP_TRACE_SENTINEL();
+    std::shared_ptr<t_port> input_port = _get_send_port(port_id);
+    if (input_port) {
+        input_port->send(fragments);
+    }
+}
+
+void
+t_gnode::send(t_uindex port_id, t_data_table&& fragments) {
+    PSP_TRACE_SENTINEL();
+    std::shared_ptr<t_port> input_port = _get_send_port(port_id);
+    if (input_port) {
+        input_port->send(std::move(fragments));
+    }
+}
+
+std::shared_ptr<t_port>
+t_gnode::_get_send_port(t_uindex port_id) {
     PSP_VERBOSE_ASSERT(m_init, "Cannot `send` to an uninited gnode.");
 
     if (m_input_ports.count(port_id) == 0) {
         std::cerr << "Cannot send table to port `" << port_id << "`, which does not exist." << std::endl;
-        return;
+        return nullptr;
     }
 
     std::shared_ptr<t_port>& input_port = m_input_ports[port_id];
-    input_port->send(fragments);
+
+    if (input_port->get_table()->size() == 0) {
+        m_pending_since[port_id] = std::chrono::high_resolution_clock::now();
+    }
+
+    return input_port;
 }
 
 bool
@@ -603,9 +720,43 @@ t_gnode::process(t_uindex port_id) {
     PerspectiveScopedGILRelease acquire(m_event_loop_thread_id);
 #endif
 
-    t_process_table_result result = _process_table(port_id);
+    t_uindex batch_rows = 0;
+    auto port_iter = m_input_ports.find(port_id);
+    if (port_iter != m_input_ports.end()) {
+        batch_rows = port_iter->second->get_table()->size();
+    }
+
+    t_process_table_result result;
+    {
+        t_metrics_timer timer(m_metrics.get(), m_metrics_prefix, "process_table");
+        result = _process_table(port_id);
+    }
+
+    if (batch_rows > 0) {
+        if (m_metrics != nullptr && m_metrics->is_enabled()) {
+            m_metrics->increment(m_metrics_prefix + "rows", batch_rows);
+            m_metrics->record(m_metrics_prefix + "batch_rows", batch_rows);
+        }
+
+        double latency_ms = 0;
+        auto since = m_pending_since.find(port_id);
+        if (since != m_pending_since.end()) {
+            std::chrono::duration<double, std::milli> latency =
+                std::chrono::high_resolution_clock::now() - since->second;
+            latency_ms = latency.count();
+            m_pending_since.erase(since);
+        }
+
+        m_batch_stats.m_num_batches += 1;
+        m_batch_stats.m_num_rows += batch_rows;
+        m_batch_stats.m_last_rows = batch_rows;
+        m_batch_stats.m_max_rows = std::max(m_batch_stats.m_max_rows, batch_rows);
+        m_batch_stats.m_last_latency_ms = latency_ms;
+        m_batch_stats.m_max_latency_ms = std::max(m_batch_stats.m_max_latency_ms, latency_ms);
+    }
 
     if (result.m_flattened_data_table) {
+        t_metrics_timer timer(m_metrics.get(), m_metrics_prefix, "notify_contexts");
         notify_contexts(*result.m_flattened_data_table);
     }
 
@@ -619,6 +770,131 @@ t_gnode::mapping_size() const {
     return m_gstate->mapping_size();
 }
 
+void
+t_gnode::get_memory_usage(t_memory_usage& usage) const {
+    m_gstate->get_memory_usage(usage);
+
+    t_uindex input_bytes = 0;
+    for (const auto& port : m_input_ports) {
+        input_bytes += port.second->get_memory_usage();
+    }
+    usage["input_ports"] += input_bytes;
+
+    t_uindex transitional_bytes = 0;
+    for (const auto& port : m_oports) {
+        transitional_bytes += port->get_memory_usage();
+    }
+    usage["transitional_tables"] += transitional_bytes;
+}
+
+void
+t_gnode::set_batch_policy(const t_batch_policy& policy) {
+    m_batch_policy = policy;
+}
+
+const t_batch_policy&
+t_gnode::get_batch_policy() const {
+    return m_batch_policy;
+}
+
+const t_batch_stats&
+t_gnode::get_batch_stats() const {
+    return m_batch_stats;
+}
+
+void
+t_gnode::set_shrink_policy(const t_shrink_policy& policy) {
+    m_shrink_policy = policy;
+    m_shrink_small_updates = 0;
+    m_shrink_recent_rows = 0;
+}
+
+const t_shrink_policy&
+t_gnode::get_shrink_policy() const {
+    return m_shrink_policy;
+}
+
+void
+t_gnode::_shrink_tables(t_uindex num_rows) {
+    const t_shrink_policy& policy = m_shrink_policy;
+    if (policy.m_min_updates == 0) {
+        return;
+    }
+
+    // Every transitional table is reserved to the same row count, so the
+    // delta table's capacity is the high-water mark for all of them.
+    t_uindex capacity = m_oports[PSP_PORT_DELTA]->get_table()->get_capacity();
+    t_uindex rows = std::max(num_rows, policy.m_min_rows);
+
+    if (static_cast<double>(capacity) <= policy.m_ratio * rows) {
+        m_shrink_small_updates = 0;
+        m_shrink_recent_rows = 0;
+        return;
+    }
+
+    m_shrink_recent_rows = std::max(m_shrink_recent_rows, rows);
+    m_shrink_small_updates += 1;
+
+    if (m_shrink_small_updates < policy.m_min_updates) {
+        return;
+    }
+
+    if (t_env::log_progress()) {
+        std::cout << "t_gnode._shrink_tables " << m_id << " capacity => " << capacity
+                  << " ncap => " << m_shrink_recent_rows << std::endl;
+    }
+
+    for (t_uindex idx = PSP_PORT_DELTA; idx <= PSP_PORT_EXISTED; ++idx) {
+        m_oports[idx]->get_table()->shrink(m_shrink_recent_rows);
+    }
+
+    for (auto& iter : m_input_ports) {
+        iter.second->get_table()->shrink(m_shrink_recent_rows);
+    }
+
+    if (policy.m_shrink_master) {
+        std::shared_ptr<t_data_table> master = m_gstate->get_table();
+        master->shrink(master->size() + m_shrink_recent_rows);
+    }
+
+    m_shrink_small_updates = 0;
+    m_shrink_recent_rows = 0;
+}
+
+t_uindex
+t_gnode::batch_wait_ms(t_uindex port_id) const {
+    auto port_iter = m_input_ports.find(port_id);
+    if (port_iter == m_input_ports.end()) {
+        return 0;
+    }
+
+    t_uindex num_rows = port_iter->second->get_table()->size();
+    const t_batch_policy& policy = m_batch_policy;
+
+    if (num_rows == 0 || policy.m_max_latency_ms == 0) {
+        return 0;
+    }
+
+    if (policy.m_max_rows > 0 && num_rows >= policy.m_max_rows) {
+        return 0;
+    }
+
+    if (policy.m_max_bytes > 0 && num_rows * m_input_row_bytes >= policy.m_max_bytes) {
+        return 0;
+    }
+
+    auto since = m_pending_since.find(port_id);
+    if (since == m_pending_since.end()) {
+        return 0;
+    }
+
+    auto age = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - since->second).count();
+    t_uindex age_ms = static_cast<t_uindex>(std::max<std::int64_t>(age, 0));
+
+    return age_ms >= policy.m_max_latency_ms ? 0 : policy.m_max_latency_ms - age_ms;
+}
+
 t_data_table*
 t_gnode::_get_otable(t_uindex port_id) {
     PSP_TRACE_SENTINEL();
@@ -924,6 +1200,7 @@ t_gnode::_unregister_context(const std::string& name) {
     PSP_VERBOSE_ASSERT(it != m_contexts.end(), "Context not found.");
 
     m_contexts.erase(name);
+    m_contexts_last_updated.erase(name);
 }
 
 void
@@ -933,34 +1210,41 @@ t_gnode::notify_contexts(const t_data_table& flattened) {
     psp_log_time(repr() + "notify_contexts.enter");
     t_index num_ctx = m_contexts.size();
     std::vector<t_ctx_handle> ctxhvec(num_ctx);
+    std::vector<const std::string*> namevec(num_ctx);
 
     t_index ctxh_count = 0;
     for (std::map<std::string, t_ctx_handle>::const_iterator iter = m_contexts.begin(); iter != m_contexts.end();
          ++iter) {
         ctxhvec[ctxh_count] = iter->second;
+        namevec[ctxh_count] = &iter->first;
         ctxh_count++;
     }
 
-    auto notify_context_helper = [this, &ctxhvec, &flattened](t_index ctxidx) {
+    // Written concurrently, so not a `std::vector<bool>`.
+    std::vector<std::uint8_t> has_deltas(num_ctx, 0);
+
+    auto notify_context_helper = [this, &ctxhvec, &has_deltas, &flattened](t_index ctxidx) {
         const t_ctx_handle& ctxh = ctxhvec[ctxidx];
+        bool ctx_has_deltas = false;
         switch (ctxh.get_type()) {
             case TWO_SIDED_CONTEXT: {
-                notify_context<t_ctx2>(flattened, ctxh);
+                ctx_has_deltas = notify_context<t_ctx2>(flattened, ctxh);
             } break;
             case ONE_SIDED_CONTEXT: {
-                notify_context<t_ctx1>(flattened, ctxh);
+                ctx_has_deltas = notify_context<t_ctx1>(flattened, ctxh);
             } break;
             case ZERO_SIDED_CONTEXT: {
-                notify_context<t_ctx0>(flattened, ctxh);
+                ctx_has_deltas = notify_context<t_ctx0>(flattened, ctxh);
             } break;
             case UNIT_CONTEXT: {
-                notify_context<t_ctxunit>(flattened, ctxh);
+                ctx_has_deltas = notify_context<t_ctxunit>(flattened, ctxh);
             } break;
             case GROUPED_PKEY_CONTEXT: {
-                notify_context<t_ctx_grouped_pkey>(flattened, ctxh);
+                ctx_has_deltas = notify_context<t_ctx_grouped_pkey>(flattened, ctxh);
             } break;
             default: { PSP_COMPLAIN_AND_ABORT("Unexpected context type"); } break;
         }
+        has_deltas[ctxidx] = ctx_has_deltas;
     };
 
     #ifdef PSP_PARALLEL_FOR
@@ -974,6 +1258,12 @@ t_gnode::notify_contexts(const t_data_table& flattened) {
         );
     #endif
 
+    for (t_index ctxidx = 0; ctxidx < num_ctx; ++ctxidx) {
+        if (has_deltas[ctxidx]) {
+            m_contexts_last_updated.insert(*namevec[ctxidx]);
+        }
+    }
+
     psp_log_time(repr() + "notify_contexts.exit");
 }
 
@@ -1241,44 +1531,8 @@ t_gnode::release_outputs() {
 
 std::vector<std::string>
 t_gnode::get_contexts_last_updated() const {
-    std::vector<std::string> rval;
-
-    for (const auto& kv : m_contexts) {
-        auto ctxh = kv.second;
-        switch (ctxh.m_ctx_type) {
-            case TWO_SIDED_CONTEXT: {
-                auto ctx = reinterpret_cast<t_ctx2*>(ctxh.m_ctx);
-                if (ctx->has_deltas()) {
-                    rval.push_back(kv.first);
-                }
-            } break;
-            case ONE_SIDED_CONTEXT: {
-                auto ctx = reinterpret_cast<t_ctx1*>(ctxh.m_ctx);
-                if (ctx->has_deltas()) {
-                    rval.push_back(kv.first);
-                }
-            } break;
-            case ZERO_SIDED_CONTEXT: {
-                auto ctx = reinterpret_cast<t_ctx0*>(ctxh.m_ctx);
-                if (ctx->has_deltas()) {
-                    rval.push_back(kv.first);
-                }
-            } break;
-            case UNIT_CONTEXT: {
-                auto ctx = reinterpret_cast<t_ctxunit*>(ctxh.m_ctx);
-                if (ctx->has_deltas()) {
-                    rval.push_back(kv.first);
-                }
-            } break;
-            case GROUPED_PKEY_CONTEXT: {
-                auto ctx = reinterpret_cast<t_ctx_grouped_pkey*>(ctxh.m_ctx);
-                if (ctx->has_deltas()) {
-                    rval.push_back(kv.first);
-                }
-            } break;
-            default: { PSP_COMPLAIN_AND_ABORT("Unexpected context type"); } break;
-        }
-    }
+    std::vector<std::string> rval(
+        m_contexts_last_updated.begin(), m_contexts_last_updated.end());
 
     if (t_env::log_progress()) {
         std::cout << "get_contexts_last_updated<" << std::endl;
@@ -1290,6 +1544,16 @@ t_gnode::get_contexts_last_updated() const {
     return rval;
 }
 
+bool
+t_gnode::has_contexts_last_updated() const {
+    return !m_contexts_last_updated.empty();
+}
+
+void
+t_gnode::clear_contexts_last_updated() {
+    m_contexts_last_updated.clear();
+}
+
 std::vector<t_tscalar>
 t_gnode::get_row_data_pkeys(const std::vector<t_tscalar>& pkeys) const {
     return m_gstate->get_row_data_pkeys(pkeys);
@@ -1326,6 +1590,7 @@ t_gnode::reset() {
         }
     }
 
+    m_contexts_last_updated.clear();
     m_gstate->reset();
 }
 
@@ -1335,6 +1600,8 @@ t_gnode::clear_input_ports() {
         std::shared_ptr<t_port> input_port = iter.second;
         input_port->get_table()->clear();
     }
+
+    m_pending_since.clear();
 }
 
 void
@@ -1364,6 +1631,12 @@ t_gnode::set_pool_cleanup(std::function<void()> cleanup) {
     m_pool_cleanup = cleanup;
 }
 
+void
+t_gnode::set_metrics(std::shared_ptr<t_metrics> metrics) {
+    m_metrics = metrics;
+    m_metrics_prefix = "gnode." + std::to_string(m_id) + ".";
+}
+
 const t_schema&
 t_gnode::get_state_input_schema() const {
     return m_gstate->get_input_schema();
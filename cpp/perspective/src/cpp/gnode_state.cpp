@@ -54,6 +54,29 @@ t_gstate::lookup(t_tscalar pkey) const {
     return rval;
 }
 
+void
+t_gstate::lookup(const t_column* pkey_col, t_uindex num_rows,
+    std::vector<t_rlookup>& out) const {
+    out.resize(num_rows);
+
+    if (m_mapping.empty()) {
+        std::fill(out.begin(), out.end(), t_rlookup(0, false));
+        return;
+    }
+
+    t_mapping::const_iterator end = m_mapping.end();
+
+    for (t_uindex idx = 0; idx < num_rows; ++idx) {
+        t_mapping::const_iterator iter = m_mapping.find(pkey_col->get_scalar(idx));
+
+        if (iter == end) {
+            out[idx] = t_rlookup(0, false);
+        } else {
+            out[idx] = t_rlookup(iter->second, true);
+        }
+    }
+}
+
 void
 t_gstate::_mark_deleted(t_uindex idx) {
     m_free.insert(idx);
@@ -109,6 +132,46 @@ t_gstate::lookup_or_create(const t_tscalar& pkey) {
     return nrows;
 }
 
+void
+t_gstate::create_rows(const std::vector<t_tscalar>& pkeys,
+    const std::vector<t_uindex>& rows,
+    std::vector<t_uindex>& master_table_indexes) {
+    t_uindex num_new = pkeys.size();
+    t_uindex idx = 0;
+
+    // Fill rows freed by earlier deletes before growing the table
+    for (t_free_items::const_iterator iter = m_free.begin();
+         idx < num_new && iter != m_free.end(); ++idx) {
+        master_table_indexes[rows[idx]] = *iter;
+        iter = m_free.erase(iter);
+    }
+
+    if (idx < num_new) {
+        t_uindex nrows = m_table->num_rows();
+        t_uindex new_size = nrows + (num_new - idx);
+
+        if (new_size >= m_table->get_capacity() - 1) {
+            m_table->reserve(std::max(
+                new_size, static_cast<t_uindex>(m_table->get_capacity() * PSP_TABLE_GROW_RATIO)));
+        }
+
+        m_table->set_size(new_size);
+
+        for (t_uindex ridx = nrows; idx < num_new; ++idx, ++ridx) {
+            master_table_indexes[rows[idx]] = ridx;
+        }
+    }
+
+    m_mapping.reserve(m_mapping.size() + num_new);
+
+    for (idx = 0; idx < num_new; ++idx) {
+        t_uindex ridx = master_table_indexes[rows[idx]];
+        m_mapping[m_symtable.get_interned_tscalar(pkeys[idx])] = ridx;
+        m_opcol->set_nth<std::uint8_t>(ridx, OP_INSERT);
+        m_pkcol->set_scalar(ridx, pkeys[idx]);
+    }
+}
+
 void
 t_gstate::fill_master_table(const t_data_table* flattened) {
     // insert into empty `m_table`
@@ -179,7 +242,8 @@ t_gstate::fill_master_table(const t_data_table* flattened) {
 }
 
 void
-t_gstate::update_master_table(const t_data_table* flattened) {
+t_gstate::update_master_table(
+    const t_data_table* flattened, const std::vector<t_rlookup>& lookup) {
     if (num_rows() == 0) {
         fill_master_table(flattened);
         return;
@@ -191,22 +255,42 @@ t_gstate::update_master_table(const t_data_table* flattened) {
     const t_column* flattened_op_col =
         flattened->get_const_column("psp_op").get();
 
+    t_uindex flattened_num_rows = flattened->num_rows();
+    PSP_VERBOSE_ASSERT(lookup.size() == flattened_num_rows,
+        "Row lookup does not match flattened table");
+
     t_data_table* master_table = m_table.get();
-    std::vector<t_uindex> master_table_indexes(flattened->num_rows());
+    std::vector<t_uindex> master_table_indexes(flattened_num_rows);
 
-    for (t_uindex idx = 0, loop_end = flattened->num_rows(); idx < loop_end; ++idx) {
+    // Inserted pkeys without a row in `m_table`, allocated together after
+    // all deletes have released their rows.
+    std::vector<t_tscalar> new_pkeys;
+    std::vector<t_uindex> new_rows;
+
+    const std::uint8_t* op_base = flattened_op_col->get_nth<std::uint8_t>(0);
+
+    for (t_uindex idx = 0; idx < flattened_num_rows; ++idx) {
         t_tscalar pkey = flattened_pkey_col->get_scalar(idx);
-        const std::uint8_t* op_ptr = flattened_op_col->get_nth<std::uint8_t>(idx);
-        t_op op = static_cast<t_op>(*op_ptr);
+        t_op op = static_cast<t_op>(op_base[idx]);
 
         switch (op) {
             case OP_INSERT: {
-                // Lookup/create the row index in `m_table` based on pkey
-                master_table_indexes[idx] = lookup_or_create(pkey);
-
-                // Write the op and pkey to `m_table`
-                m_opcol->set_nth<std::uint8_t>(master_table_indexes[idx], OP_INSERT);
-                m_pkcol->set_scalar(master_table_indexes[idx], pkey);
+                // `flatten` writes a delete directly before an insert of the
+                // same pkey, which releases the row found by `lookup`.
+                bool replaced = idx > 0 && op_base[idx - 1] == OP_DELETE
+                    && flattened_pkey_col->get_scalar(idx - 1) == pkey;
+
+                if (lookup[idx].m_exists && !replaced) {
+                    t_uindex ridx = lookup[idx].m_idx;
+                    master_table_indexes[idx] = ridx;
+
+                    // Write the op and pkey to `m_table`
+                    m_opcol->set_nth<std::uint8_t>(ridx, OP_INSERT);
+                    m_pkcol->set_scalar(ridx, pkey);
+                } else {
+                    new_pkeys.push_back(pkey);
+                    new_rows.push_back(idx);
+                }
             } break;
             case OP_DELETE: {
                 // Actually erase the specified pkey from the master table here
@@ -216,6 +300,10 @@ t_gstate::update_master_table(const t_data_table* flattened) {
         }
     }
 
+    if (!new_rows.empty()) {
+        create_rows(new_pkeys, new_rows, master_table_indexes);
+    }
+
     const t_schema& master_schema = m_table->get_schema();
     t_uindex ncols = master_table->num_columns();
 #ifdef PSP_PARALLEL_FOR
@@ -254,88 +342,166 @@ t_gstate::update_master_column(
     const t_column* op_column,
     const std::vector<t_uindex>& master_table_indexes,
     t_uindex num_rows) {
-    for (t_uindex idx = 0, loop_end = num_rows; idx < loop_end; ++idx) {
-        bool is_valid = flattened_column->is_valid(idx);
-        t_uindex master_table_idx = master_table_indexes[idx];
-
-        if (!is_valid) {
-            bool is_cleared = flattened_column->is_cleared(idx);
-            if (is_cleared) {
-                master_column->clear(master_table_idx);
-            }
-            continue;
-        }
-
-        const std::uint8_t* op_ptr = op_column->get_nth<std::uint8_t>(idx);
-        t_op op = static_cast<t_op>(*op_ptr);
+    switch (flattened_column->get_dtype()) {
+        case DTYPE_NONE: {
+        } break;
+        case DTYPE_TIME:
+        case DTYPE_INT64: {
+            update_master_column_helper<std::int64_t>(
+                master_column, flattened_column, op_column, master_table_indexes, num_rows);
+        } break;
+        case DTYPE_INT32: {
+            update_master_column_helper<std::int32_t>(
+                master_column, flattened_column, op_column, master_table_indexes, num_rows);
+        } break;
+        case DTYPE_INT16: {
+            update_master_column_helper<std::int16_t>(
+                master_column, flattened_column, op_column, master_table_indexes, num_rows);
+        } break;
+        case DTYPE_INT8: {
+            update_master_column_helper<std::int8_t>(
+                master_column, flattened_column, op_column, master_table_indexes, num_rows);
+        } break;
+        case DTYPE_OBJECT:
+        case DTYPE_UINT64: {
+            update_master_column_helper<std::uint64_t>(
+                master_column, flattened_column, op_column, master_table_indexes, num_rows);
+        } break;
+        case DTYPE_DATE:
+        case DTYPE_UINT32: {
+            update_master_column_helper<std::uint32_t>(
+                master_column, flattened_column, op_column, master_table_indexes, num_rows);
+        } break;
+        case DTYPE_UINT16: {
+            update_master_column_helper<std::uint16_t>(
+                master_column, flattened_column, op_column, master_table_indexes, num_rows);
+        } break;
+        case DTYPE_BOOL:
+        case DTYPE_UINT8: {
+            update_master_column_helper<std::uint8_t>(
+                master_column, flattened_column, op_column, master_table_indexes, num_rows);
+        } break;
+        case DTYPE_FLOAT64: {
+            update_master_column_helper<double>(
+                master_column, flattened_column, op_column, master_table_indexes, num_rows);
+        } break;
+        case DTYPE_FLOAT32: {
+            update_master_column_helper<float>(
+                master_column, flattened_column, op_column, master_table_indexes, num_rows);
+        } break;
+        case DTYPE_STR: {
+            // Strings are interned into the master column's own vocab, so
+            // they cannot be copied as raw vocab indices.
+            for (t_uindex idx = 0; idx < num_rows; ++idx) {
+                // Deleted rows were already cleared by `erase`, and have no
+                // row index of their own in `master_table_indexes`.
+                const std::uint8_t* op_ptr = op_column->get_nth<std::uint8_t>(idx);
+                t_op op = static_cast<t_op>(*op_ptr);
+
+                if (op == OP_DELETE)
+                    continue;
+
+                t_uindex master_table_idx = master_table_indexes[idx];
+
+                if (!flattened_column->is_valid(idx)) {
+                    if (flattened_column->is_cleared(idx)) {
+                        master_column->clear(master_table_idx);
+                    }
+                    continue;
+                }
 
-        if (op == OP_DELETE)
-            continue;
-
-        switch (flattened_column->get_dtype()) {
-            case DTYPE_NONE: {
-            } break;
-            case DTYPE_INT64: {
-                master_column->set_nth<std::int64_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::int64_t>(idx)));
-            } break;
-            case DTYPE_INT32: {
-                master_column->set_nth<std::int32_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::int32_t>(idx)));
-            } break;
-            case DTYPE_INT16: {
-                master_column->set_nth<std::int16_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::int16_t>(idx)));
-            } break;
-            case DTYPE_INT8: {
-                master_column->set_nth<std::int8_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::int8_t>(idx)));
-            } break;
-            case DTYPE_UINT64: {
-                master_column->set_nth<std::uint64_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::uint64_t>(idx)));
-            } break;
-            case DTYPE_UINT32: {
-                master_column->set_nth<std::uint32_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::uint32_t>(idx)));
-            } break;
-            case DTYPE_UINT16: {
-                master_column->set_nth<std::uint16_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::uint16_t>(idx)));
-            } break;
-            case DTYPE_UINT8: {
-                master_column->set_nth<std::uint8_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::uint8_t>(idx)));
-            } break;
-            case DTYPE_FLOAT64: {
-                master_column->set_nth<double>(master_table_idx, *(flattened_column->get_nth<double>(idx)));
-            } break;
-            case DTYPE_FLOAT32: {
-                master_column->set_nth<float>(master_table_idx, *(flattened_column->get_nth<float>(idx)));
-            } break;
-            case DTYPE_BOOL: {
-                master_column->set_nth<std::uint8_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::uint8_t>(idx)));
-            } break;
-            case DTYPE_TIME: {
-                master_column->set_nth<std::int64_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::int64_t>(idx)));
-            } break;
-            case DTYPE_DATE: {
-                master_column->set_nth<std::uint32_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::uint32_t>(idx)));
-            } break;
-            case DTYPE_STR: {
                 master_column->set_nth<const char*>(
                     master_table_idx, flattened_column->get_nth<const char>(idx));
-            } break;
-            case DTYPE_OBJECT: {
-                // inform new column its being copied
-                master_column->set_nth<std::uint64_t>(
-                    master_table_idx, *(flattened_column->get_nth<std::uint64_t>(idx)));
+            }
+        } break;
+        default: { PSP_COMPLAIN_AND_ABORT("Unexpected type"); }
+    }
+}
 
-            } break;
-            default: { PSP_COMPLAIN_AND_ABORT("Unexpected type"); }
+void
+t_gstate::lookup_rows(const std::vector<t_tscalar>& pkeys,
+    std::vector<t_uindex>& row_indices, std::vector<t_uindex>& positions) const {
+    t_uindex num_pkeys = pkeys.size();
+    row_indices.clear();
+    positions.clear();
+    row_indices.reserve(num_pkeys);
+    positions.reserve(num_pkeys);
+
+    for (t_uindex idx = 0; idx < num_pkeys; ++idx) {
+        t_mapping::const_iterator iter = m_mapping.find(pkeys[idx]);
+        if (iter != m_mapping.end()) {
+            row_indices.push_back(iter->second);
+            positions.push_back(idx);
+        }
+    }
+}
+
+void
+t_gstate::gather_column(const t_column* column, const t_uindex* row_indices,
+    t_uindex start_idx, t_uindex num_rows, t_tscalar* out) const {
+    if (num_rows == 0) {
+        return;
+    }
+
+    switch (column->get_dtype()) {
+        case DTYPE_INT64: {
+            gather_column_helper<std::int64_t, std::int64_t>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_INT32: {
+            gather_column_helper<std::int32_t, std::int32_t>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_INT16: {
+            gather_column_helper<std::int16_t, std::int16_t>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_INT8: {
+            gather_column_helper<std::int8_t, std::int8_t>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_UINT64: {
+            gather_column_helper<std::uint64_t, std::uint64_t>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_UINT32: {
+            gather_column_helper<std::uint32_t, std::uint32_t>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_UINT16: {
+            gather_column_helper<std::uint16_t, std::uint16_t>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_UINT8: {
+            gather_column_helper<std::uint8_t, std::uint8_t>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_FLOAT64: {
+            gather_column_helper<double, double>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_FLOAT32: {
+            gather_column_helper<float, float>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_BOOL: {
+            gather_column_helper<bool, bool>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_TIME: {
+            gather_column_helper<t_time::t_rawtype, t_time>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        case DTYPE_DATE: {
+            gather_column_helper<t_date::t_rawtype, t_date>(
+                column, row_indices, start_idx, num_rows, out);
+        } break;
+        default: {
+            // Strings, objects and pairs need per-value handling
+            for (t_uindex idx = 0; idx < num_rows; ++idx) {
+                out[idx] = column->get_scalar(
+                    row_indices ? row_indices[idx] : start_idx + idx);
+            }
         }
     }
 }
@@ -379,10 +545,19 @@ t_gstate::read_column(const std::string& colname, const std::vector<t_tscalar>&
     const t_column* col_ = col.get();
     std::vector<t_tscalar> rval(num_rows);
 
-    for (t_index idx = 0; idx < num_rows; ++idx) {
-        t_mapping::const_iterator iter = m_mapping.find(pkeys[idx]);
-        if (iter != m_mapping.end()) {
-            rval[idx].set(col_->get_scalar(iter->second));
+    std::vector<t_uindex> row_indices;
+    std::vector<t_uindex> positions;
+    lookup_rows(pkeys, row_indices, positions);
+
+    t_uindex num_found = row_indices.size();
+
+    if (num_found == static_cast<t_uindex>(num_rows)) {
+        gather_column(col_, row_indices.data(), 0, num_found, rval.data());
+    } else {
+        std::vector<t_tscalar> found(num_found);
+        gather_column(col_, row_indices.data(), 0, num_found, found.data());
+        for (t_uindex idx = 0; idx < num_found; ++idx) {
+            rval[positions[idx]] = found[idx];
         }
     }
 
@@ -398,19 +573,22 @@ t_gstate::read_column(const std::string& colname, const std::vector<t_tscalar>&
 void
 t_gstate::read_column(const std::string& colname, const std::vector<t_tscalar>& pkeys,
     std::vector<double>& out_data, bool include_nones) const {
-    t_index num_rows = pkeys.size();
     std::shared_ptr<const t_column> col = m_table->get_const_column(colname);
     const t_column* col_ = col.get();
 
+    std::vector<t_uindex> row_indices;
+    std::vector<t_uindex> positions;
+    lookup_rows(pkeys, row_indices, positions);
+
+    t_uindex num_found = row_indices.size();
+    std::vector<t_tscalar> found(num_found);
+    gather_column(col_, row_indices.data(), 0, num_found, found.data());
+
     std::vector<double> rval;
-    rval.reserve(num_rows);
-    for (t_index idx = 0; idx < num_rows; ++idx) {
-        t_mapping::const_iterator iter = m_mapping.find(pkeys[idx]);
-        if (iter != m_mapping.end()) {
-            auto tscalar = col_->get_scalar(iter->second);
-            if (include_nones || tscalar.is_valid()) {
-                rval.push_back(tscalar.to_double());
-            }
+    rval.reserve(num_found);
+    for (const auto& tscalar : found) {
+        if (include_nones || tscalar.is_valid()) {
+            rval.push_back(tscalar.to_double());
         }
     }
     std::swap(rval, out_data);
@@ -433,12 +611,7 @@ t_gstate::read_column(
     const t_column* col_ = col.get();
 
     std::vector<t_tscalar> rval(num_rows);
-
-    t_uindex i = 0;
-    for (t_uindex idx = start_idx; idx < end_idx; ++idx) {
-        rval[i] = col_->get_scalar(idx);
-        i++;
-    }
+    gather_column(col_, nullptr, start_idx, num_rows, rval.data());
 
     std::swap(rval, out_data);
 }
@@ -453,12 +626,7 @@ t_gstate::read_column(
 
     t_index num_rows = row_indices.size();
     std::vector<t_tscalar> rval(num_rows);
-
-    t_uindex i = 0;
-    for (auto idx : row_indices) {
-        rval[i] = col_->get_scalar(idx);
-        i++;
-    }
+    gather_column(col_, row_indices.data(), 0, num_rows, rval.data());
 
     std::swap(rval, out_data);
 }
@@ -832,6 +1000,16 @@ t_gstate::mapping_size() const {
     return m_mapping.size();
 }
 
+void
+t_gstate::get_memory_usage(t_memory_usage& usage) const {
+    if (m_table) {
+        usage["master_table"] += m_table->get_memory_usage();
+    }
+
+    usage["mapping"] += hash_memory_usage(m_mapping) + hash_memory_usage(m_free)
+        + m_symtable.get_memory_usage();
+}
+
 void
 t_gstate::reset() {
     m_table->reset();
@@ -0,0 +1,544 @@
+/******************************************************************************
+ *
+ * Copyright (c) 2019, the Perspective Authors.
+ *
+ * This file is part of the Perspective library, distributed under the terms of
+ * the Apache License 2.0.  The full license can be found in the LICENSE file.
+ *
+ */
+
+#include <perspective/json_loader.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+
+namespace perspective {
+namespace json {
+
+    namespace {
+        const unsigned PARSE_FLAGS
+            = rapidjson::kParseInsituFlag | rapidjson::kParseStopWhenDoneFlag;
+
+        void
+        abort_on_parse_error(const rapidjson::Document& document) {
+            std::stringstream ss;
+            ss << "Failed to parse JSON at offset " << document.GetErrorOffset()
+               << ": " << rapidjson::GetParseError_En(document.GetParseError())
+               << std::endl;
+            PSP_COMPLAIN_AND_ABORT(ss.str());
+        }
+
+        bool
+        get_double(const rapidjson::Value& value, double& out) {
+            if (value.IsNumber()) {
+                out = value.GetDouble();
+                return true;
+            } else if (value.IsBool()) {
+                out = value.GetBool() ? 1 : 0;
+                return true;
+            } else if (value.IsString()) {
+                const char* str = value.GetString();
+                char* end = nullptr;
+                out = std::strtod(str, &end);
+                return end != str && *end == '\0';
+            }
+
+            return false;
+        }
+
+        bool
+        get_int64(const rapidjson::Value& value, std::int64_t& out) {
+            if (value.IsInt64()) {
+                out = value.GetInt64();
+                return true;
+            }
+
+            double dval;
+            if (!get_double(value, dval)) {
+                return false;
+            }
+
+            out = static_cast<std::int64_t>(dval);
+            return true;
+        }
+    } // namespace
+
+    JsonLoader::JsonLoader()
+        : m_format(JSON_FORMAT_RECORDS)
+        , m_row_count(0) {}
+
+    JsonLoader::~JsonLoader() {}
+
+    void
+    JsonLoader::initialize(std::string json) {
+        m_buffer = std::move(json);
+        if (m_buffer.empty()) {
+            return;
+        }
+
+        char* begin = &m_buffer[0];
+        rapidjson::InsituStringStream stream(begin);
+        rapidjson::SkipWhitespace(stream);
+
+        if (stream.Peek() == '\0') {
+            return;
+        }
+
+        m_document.ParseStream<PARSE_FLAGS>(stream);
+        if (m_document.HasParseError()) {
+            abort_on_parse_error(m_document);
+        }
+
+        rapidjson::SkipWhitespace(stream);
+
+        if (stream.Peek() != '\0') {
+            // Newline-delimited JSON - parse each remaining record into the
+            // same allocator, then collect them into an array of records.
+            auto& allocator = m_document.GetAllocator();
+            rapidjson::Value first;
+            first.Swap(m_document);
+            m_document.SetArray();
+            m_document.PushBack(first, allocator);
+
+            while (stream.Peek() != '\0') {
+                rapidjson::Document record(&allocator);
+                record.ParseStream<PARSE_FLAGS>(stream);
+                if (record.HasParseError()) {
+                    abort_on_parse_error(record);
+                }
+
+                rapidjson::Value value;
+                value.Swap(record);
+                m_document.PushBack(value, allocator);
+                rapidjson::SkipWhitespace(stream);
+            }
+
+            parse_records(m_document);
+        } else if (m_document.IsArray()) {
+            parse_records(m_document);
+        } else if (m_document.IsObject()) {
+            bool is_columns = m_document.MemberCount() > 0;
+            for (auto it = m_document.MemberBegin(); it != m_document.MemberEnd(); ++it) {
+                if (!it->value.IsArray()) {
+                    is_columns = false;
+                    break;
+                }
+            }
+
+            if (is_columns) {
+                parse_columns(m_document);
+            } else {
+                // A single record
+                rapidjson::Value record;
+                record.Swap(m_document);
+                m_document.SetArray();
+                m_document.PushBack(record, m_document.GetAllocator());
+                parse_records(m_document);
+            }
+        } else {
+            PSP_COMPLAIN_AND_ABORT(
+                "JSON data must be an array of records, an object of columns, or newline-delimited records.");
+        }
+
+        m_types.reserve(m_names.size());
+        for (t_uindex cidx = 0; cidx < m_names.size(); ++cidx) {
+            m_types.push_back(infer_type(cidx));
+        }
+    }
+
+    void
+    JsonLoader::parse_records(const rapidjson::Value& records) {
+        m_format = JSON_FORMAT_RECORDS;
+        m_row_count = records.Size();
+
+        // Records usually list their keys in the same order, so the key at
+        // each position is checked against the column at that position
+        // before falling back to a lookup.
+        std::unordered_map<std::string, t_uindex> name_to_cidx;
+
+        for (std::uint32_t ridx = 0; ridx < m_row_count; ++ridx) {
+            const rapidjson::Value& record = records[ridx];
+            if (!record.IsObject()) {
+                std::stringstream ss;
+                ss << "JSON record " << ridx << " is not an object." << std::endl;
+                PSP_COMPLAIN_AND_ABORT(ss.str());
+            }
+
+            t_uindex midx = 0;
+            for (auto it = record.MemberBegin(); it != record.MemberEnd(); ++it, ++midx) {
+                const char* key = it->name.GetString();
+                t_uindex key_len = it->name.GetStringLength();
+                t_uindex cidx;
+
+                if (midx < m_names.size() && m_names[midx].size() == key_len
+                    && std::memcmp(m_names[midx].data(), key, key_len) == 0) {
+                    cidx = midx;
+                } else {
+                    std::string name(key, key_len);
+                    auto lookup = name_to_cidx.find(name);
+                    if (lookup != name_to_cidx.end()) {
+                        cidx = lookup->second;
+                    } else {
+                        cidx = m_names.size();
+                        name_to_cidx.emplace(name, cidx);
+                        m_names.push_back(name);
+                        m_cells.push_back(
+                            std::vector<const rapidjson::Value*>(m_row_count, nullptr));
+                    }
+                }
+
+                m_cells[cidx][ridx] = &it->value;
+            }
+        }
+    }
+
+    void
+    JsonLoader::parse_columns(const rapidjson::Value& columns) {
+        m_format = JSON_FORMAT_COLUMNS;
+        m_row_count = 0;
+
+        for (auto it = columns.MemberBegin(); it != columns.MemberEnd(); ++it) {
+            m_names.push_back(
+                std::string(it->name.GetString(), it->name.GetStringLength()));
+            m_columns.push_back(&it->value);
+            m_row_count = std::max(m_row_count, it->value.Size());
+        }
+    }
+
+    const rapidjson::Value*
+    JsonLoader::get_cell(t_uindex cidx, t_uindex ridx) const {
+        if (m_format == JSON_FORMAT_COLUMNS) {
+            const rapidjson::Value& column = *m_columns[cidx];
+            return ridx < column.Size() ? &column[ridx] : nullptr;
+        }
+
+        return m_cells[cidx][ridx];
+    }
+
+    t_dtype
+    JsonLoader::infer_type(t_uindex cidx) const {
+        bool has_bool = false;
+        bool has_int32 = false;
+        bool has_int64 = false;
+        bool has_float = false;
+        bool has_string = false;
+        bool has_nested = false;
+        bool strings_are_dates = true;
+        bool has_datetime = false;
+
+        for (t_uindex ridx = 0; ridx < m_row_count; ++ridx) {
+            const rapidjson::Value* value = get_cell(cidx, ridx);
+            if (value == nullptr || value->IsNull()) {
+                continue;
+            }
+
+            switch (value->GetType()) {
+                case rapidjson::kFalseType:
+                case rapidjson::kTrueType: {
+                    has_bool = true;
+                } break;
+                case rapidjson::kNumberType: {
+                    if (value->IsInt()) {
+                        has_int32 = true;
+                    } else if (value->IsInt64()) {
+                        has_int64 = true;
+                    } else {
+                        has_float = true;
+                    }
+                } break;
+                case rapidjson::kStringType: {
+                    has_string = true;
+                    if (strings_are_dates) {
+                        t_parsed_datetime parsed;
+                        strings_are_dates = m_date_parser.parse(
+                            value->GetString(), value->GetStringLength(), parsed);
+                        has_datetime = has_datetime || parsed.m_has_time;
+                    }
+                } break;
+                default: {
+                    has_nested = true;
+                } break;
+            }
+        }
+
+        bool has_number = has_int32 || has_int64 || has_float;
+
+        if (has_nested) {
+            return DTYPE_STR;
+        } else if (has_string) {
+            if (strings_are_dates && !has_bool && !has_number) {
+                return has_datetime ? DTYPE_TIME : DTYPE_DATE;
+            }
+
+            return DTYPE_STR;
+        } else if (has_float) {
+            return DTYPE_FLOAT64;
+        } else if (has_int64) {
+            return DTYPE_INT64;
+        } else if (has_int32) {
+            return DTYPE_INT32;
+        } else if (has_bool) {
+            return DTYPE_BOOL;
+        }
+
+        return DTYPE_STR;
+    }
+
+    void
+    JsonLoader::fill_table(
+        t_data_table& tbl,
+        const t_schema& input_schema,
+        const std::string& index,
+        std::uint32_t offset,
+        std::uint32_t limit,
+        bool is_update) {
+        bool implicit_index = false;
+
+        // Resolve target columns up front, as adding columns to `tbl` is not
+        // thread safe, then fill each column independently.
+        std::vector<t_uindex> fill_cidxs;
+        std::vector<std::shared_ptr<t_column>> fill_cols;
+        std::vector<t_dtype> fill_types;
+
+        for (t_uindex cidx = 0; cidx < m_names.size(); ++cidx) {
+            const std::string& name = m_names[cidx];
+
+            if (!input_schema.has_column(name)) {
+                // Skip columns that are defined in the JSON but not in the
+                // Table's input schema.
+                continue;
+            }
+
+            t_dtype type = input_schema.get_dtype(name);
+
+            if (name == "__INDEX__") {
+                implicit_index = true;
+                fill_cols.push_back(tbl.add_column_sptr("psp_pkey", type, true));
+            } else {
+                fill_cols.push_back(tbl.get_column(name));
+            }
+
+            fill_cidxs.push_back(cidx);
+            fill_types.push_back(type);
+        }
+
+#ifdef PSP_PARALLEL_FOR
+        tbb::parallel_for(0, int(fill_cols.size()), 1,
+            [&fill_cidxs, &fill_cols, &fill_types, is_update, this](int idx)
+#else
+        for (t_uindex idx = 0, loop_end = fill_cols.size(); idx < loop_end; ++idx)
+#endif
+            {
+                fill_column(fill_cols[idx], fill_cidxs[idx], fill_types[idx], is_update);
+            }
+#ifdef PSP_PARALLEL_FOR
+        );
+#endif
+
+        if (implicit_index) {
+            tbl.clone_column("psp_pkey", "psp_okey");
+        }
+
+        // Fill index column - recreated every time a `t_data_table` is created.
+        if (!implicit_index) {
+            if (index == "") {
+                // Use row number as index if not explicitly provided or provided with
+                // `__INDEX__`
+                auto key_col = tbl.add_column("psp_pkey", DTYPE_INT32, true);
+                auto okey_col = tbl.add_column("psp_okey", DTYPE_INT32, true);
+
+                for (std::uint32_t ridx = 0; ridx < tbl.size(); ++ridx) {
+                    key_col->set_nth<std::int32_t>(ridx, (ridx + offset) % limit);
+                    okey_col->set_nth<std::int32_t>(ridx, (ridx + offset) % limit);
+                }
+            } else {
+                if (!input_schema.has_column(index)) {
+                    std::stringstream ss;
+                    ss << "Specified index `" << index << "` is invalid as it does not appear in the Table." << std::endl;
+                    PSP_COMPLAIN_AND_ABORT(ss.str());
+                }
+
+                tbl.clone_column(index, "psp_pkey");
+                tbl.clone_column(index, "psp_okey");
+            }
+        }
+    }
+
+    void
+    JsonLoader::fill_column(
+        std::shared_ptr<t_column> col, t_uindex cidx, t_dtype type, bool is_update) const {
+        rapidjson::StringBuffer buffer;
+
+        for (std::uint32_t ridx = 0; ridx < m_row_count; ++ridx) {
+            const rapidjson::Value* value = get_cell(cidx, ridx);
+
+            // Missing keys leave the cell untouched, as in the accessor path.
+            if (value == nullptr) {
+                continue;
+            }
+
+            if (value->IsNull()) {
+                if (is_update) {
+                    col->unset(ridx);
+                } else {
+                    col->clear(ridx);
+                }
+                continue;
+            }
+
+            // Values that cannot be converted to `type` are written as null.
+            bool valid = true;
+
+            switch (type) {
+                case DTYPE_STR: {
+                    if (value->IsString()) {
+                        col->set_nth<const char*>(ridx, value->GetString());
+                    } else {
+                        buffer.Clear();
+                        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+                        value->Accept(writer);
+                        col->set_nth<const char*>(ridx, buffer.GetString());
+                    }
+                } break;
+                case DTYPE_BOOL: {
+                    if (value->IsBool()) {
+                        col->set_nth<bool>(ridx, value->GetBool());
+                    } else if (value->IsNumber()) {
+                        col->set_nth<bool>(ridx, value->GetDouble() != 0);
+                    } else if (value->IsString()) {
+                        std::string str(value->GetString(), value->GetStringLength());
+                        std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+                        valid = str == "true" || str == "false";
+                        if (valid) {
+                            col->set_nth<bool>(ridx, str == "true");
+                        }
+                    } else {
+                        valid = false;
+                    }
+                } break;
+                case DTYPE_DATE: {
+                    t_parsed_datetime parsed;
+                    valid = value->IsString()
+                        && m_date_parser.parse(
+                            value->GetString(), value->GetStringLength(), parsed);
+                    if (valid) {
+                        col->set_nth<t_date>(
+                            ridx, t_date(parsed.m_year, parsed.m_month - 1, parsed.m_day));
+                    }
+                } break;
+                case DTYPE_TIME: {
+                    t_parsed_datetime parsed;
+                    std::int64_t ms;
+                    if (value->IsString()) {
+                        // Datetimes without a timezone are in local time, as
+                        // in the other loaders.
+                        valid = m_date_parser.parse(
+                                    value->GetString(), value->GetStringLength(), parsed)
+                            && parsed.to_local_epoch_ms(ms);
+                        if (valid) {
+                            col->set_nth<std::int64_t>(ridx, ms);
+                        }
+                    } else if (value->IsNumber()) {
+                        // Numbers are milliseconds since the epoch.
+                        valid = get_int64(*value, ms);
+                        if (valid) {
+                            col->set_nth<std::int64_t>(ridx, ms);
+                        }
+                    } else {
+                        valid = false;
+                    }
+                } break;
+                case DTYPE_FLOAT64:
+                case DTYPE_FLOAT32: {
+                    double dval;
+                    valid = get_double(*value, dval);
+                    if (valid) {
+                        if (type == DTYPE_FLOAT64) {
+                            col->set_nth<double>(ridx, dval);
+                        } else {
+                            col->set_nth<float>(ridx, static_cast<float>(dval));
+                        }
+                    }
+                } break;
+                case DTYPE_INT8:
+                case DTYPE_INT16:
+                case DTYPE_INT32:
+                case DTYPE_INT64:
+                case DTYPE_UINT8:
+                case DTYPE_UINT16:
+                case DTYPE_UINT32:
+                case DTYPE_UINT64: {
+                    std::int64_t ival;
+                    valid = get_int64(*value, ival);
+                    if (!valid) {
+                        break;
+                    }
+
+                    switch (type) {
+                        case DTYPE_INT8: {
+                            col->set_nth<std::int8_t>(ridx, static_cast<std::int8_t>(ival));
+                        } break;
+                        case DTYPE_INT16: {
+                            col->set_nth<std::int16_t>(ridx, static_cast<std::int16_t>(ival));
+                        } break;
+                        case DTYPE_INT32: {
+                            col->set_nth<std::int32_t>(ridx, static_cast<std::int32_t>(ival));
+                        } break;
+                        case DTYPE_INT64: {
+                            col->set_nth<std::int64_t>(ridx, ival);
+                        } break;
+                        case DTYPE_UINT8: {
+                            col->set_nth<std::uint8_t>(ridx, static_cast<std::uint8_t>(ival));
+                        } break;
+                        case DTYPE_UINT16: {
+                            col->set_nth<std::uint16_t>(ridx, static_cast<std::uint16_t>(ival));
+                        } break;
+                        case DTYPE_UINT32: {
+                            col->set_nth<std::uint32_t>(ridx, static_cast<std::uint32_t>(ival));
+                        } break;
+                        default: {
+                            col->set_nth<std::uint64_t>(ridx, static_cast<std::uint64_t>(ival));
+                        } break;
+                    }
+                } break;
+                default: {
+                    std::stringstream ss;
+                    ss << "Cannot load JSON into column of type " << get_dtype_descr(type) << std::endl;
+                    PSP_COMPLAIN_AND_ABORT(ss.str());
+                }
+            }
+
+            if (!valid) {
+                col->clear(ridx);
+            }
+        }
+    }
+
+    std::vector<std::string>
+    JsonLoader::names() const {
+        return m_names;
+    }
+
+    std::vector<t_dtype>
+    JsonLoader::types() const {
+        return m_types;
+    }
+
+    std::uint32_t
+    JsonLoader::row_count() const {
+        return m_row_count;
+    }
+
+    t_json_format
+    JsonLoader::format() const {
+        return m_format;
+    }
+
+} // namespace json
+} // namespace perspective
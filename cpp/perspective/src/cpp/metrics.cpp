@@ -0,0 +1,366 @@
+/******************************************************************************
+ *
+ * Copyright (c) 2017, the Perspective Authors.
+ *
+ * This file is part of the Perspective library, distributed under the terms of
+ * the Apache License 2.0.  The full license can be found in the LICENSE file.
+ *
+ */
+
+#include <perspective/first.h>
+#include <perspective/metrics.h>
+#include <perspective/compat.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace perspective {
+
+namespace {
+    const t_uindex NUM_HISTOGRAM_BUCKETS = 64;
+
+    // The OS thread id of the calling thread, looked up once per thread.
+    std::uint64_t
+    get_thread_id() {
+        static thread_local std::uint64_t tid = psp_thread_id();
+        return tid;
+    }
+
+    // Nanoseconds on a monotonic clock. `psp_curtime` is not implemented
+    // on macOS, where it always returns 0.
+    std::int64_t
+    now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    void
+    write_json_string(std::ostream& out, const char* str, t_uindex len) {
+        out << '"';
+        for (t_uindex idx = 0; idx < len; ++idx) {
+            char c = str[idx];
+            switch (c) {
+                case '"': out << "\\\""; break;
+                case '\\': out << "\\\\"; break;
+                case '\n': out << "\\n"; break;
+                case '\r': out << "\\r"; break;
+                case '\t': out << "\\t"; break;
+                default: {
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                            << static_cast<int>(c) << std::dec << std::setfill(' ');
+                    } else {
+                        out << c;
+                    }
+                }
+            }
+        }
+        out << '"';
+    }
+
+    void
+    write_json_string(std::ostream& out, const std::string& str) {
+        write_json_string(out, str.data(), str.size());
+    }
+} // namespace
+
+t_metric_histogram::t_metric_histogram()
+    : m_count(0)
+    , m_sum(0)
+    , m_min(std::numeric_limits<std::int64_t>::max())
+    , m_max(std::numeric_limits<std::int64_t>::min())
+    , m_buckets(NUM_HISTOGRAM_BUCKETS, 0) {}
+
+void
+t_metric_histogram::record(std::int64_t value) {
+    t_uindex bucket = 0;
+    for (std::uint64_t remaining = value > 0 ? value : 0; remaining > 0; remaining >>= 1) {
+        ++bucket;
+    }
+
+    m_buckets[std::min(bucket, NUM_HISTOGRAM_BUCKETS - 1)] += 1;
+    m_count += 1;
+    m_sum += value;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+}
+
+double
+t_metric_histogram::mean() const {
+    return m_count == 0 ? 0 : static_cast<double>(m_sum) / m_count;
+}
+
+std::int64_t
+t_metric_histogram::percentile(double p) const {
+    if (m_count == 0) {
+        return 0;
+    }
+
+    t_uindex target = static_cast<t_uindex>(std::ceil(p * m_count));
+    t_uindex seen = 0;
+    for (t_uindex bucket = 0; bucket < m_buckets.size(); ++bucket) {
+        seen += m_buckets[bucket];
+        if (seen >= target && seen > 0) {
+            if (bucket == 0) {
+                return std::min<std::int64_t>(0, m_max);
+            }
+
+            std::int64_t upper = bucket >= 63
+                ? std::numeric_limits<std::int64_t>::max()
+                : (std::int64_t(1) << bucket) - 1;
+            return std::min(upper, m_max);
+        }
+    }
+
+    return m_max;
+}
+
+t_metrics::t_metrics()
+    : m_enabled(false)
+    , m_tracing(false)
+    , m_trace_capacity(0)
+    , m_trace_head(0) {}
+
+void
+t_metrics::set_enabled(bool enabled) {
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool
+t_metrics::is_enabled() const {
+    return m_enabled.load(std::memory_order_relaxed);
+}
+
+void
+t_metrics::set_tracing(bool enabled, t_uindex capacity) {
+    std::lock_guard<std::mutex> lk(m_mtx);
+    m_trace.clear();
+    m_trace.shrink_to_fit();
+    m_trace_head = 0;
+    m_trace_capacity = enabled ? capacity : 0;
+
+    if (enabled) {
+        m_trace.reserve(capacity);
+        m_enabled.store(true, std::memory_order_relaxed);
+    }
+
+    m_tracing.store(enabled, std::memory_order_relaxed);
+}
+
+bool
+t_metrics::is_tracing() const {
+    return m_tracing.load(std::memory_order_relaxed);
+}
+
+void
+t_metrics::increment(const std::string& name, std::int64_t delta) {
+    if (!is_enabled()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lk(m_mtx);
+    m_counters[name] += delta;
+}
+
+void
+t_metrics::set_gauge(const std::string& name, std::int64_t value) {
+    if (!is_enabled()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lk(m_mtx);
+    m_counters[name] = value;
+}
+
+void
+t_metrics::record(const std::string& name, std::int64_t value) {
+    if (!is_enabled()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lk(m_mtx);
+    m_histograms[name].record(value);
+}
+
+void
+t_metrics::record_duration(
+    const std::string& name, std::int64_t begin_ns, std::int64_t end_ns) {
+    if (!is_enabled()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lk(m_mtx);
+    m_histograms[name].record(end_ns - begin_ns);
+
+    if (!is_tracing() || m_trace_capacity == 0) {
+        return;
+    }
+
+    auto iter = m_trace_ids.find(name);
+    std::uint64_t id;
+    if (iter == m_trace_ids.end()) {
+        id = m_trace_names.size();
+        m_trace_ids[name] = id;
+        m_trace_names.push_back(name);
+    } else {
+        id = iter->second;
+    }
+
+    t_instrec rec;
+    std::memset(&rec, 0, sizeof(t_instrec));
+    rec.m_time = begin_ns;
+    rec.m_id = id;
+    rec.m_trace_type = TRACE_TYPE_DURATION_TWO_SIDED;
+    rec.t_fntrace.m_duration = end_ns - begin_ns;
+    std::uint64_t tid = get_thread_id();
+    std::memcpy(rec.t_fntrace.m_payload, &tid, sizeof(tid));
+
+    if (m_trace.size() < m_trace_capacity) {
+        m_trace.push_back(rec);
+    } else {
+        m_trace[m_trace_head] = rec;
+        m_trace_head = (m_trace_head + 1) % m_trace_capacity;
+    }
+}
+
+std::map<std::string, std::int64_t>
+t_metrics::get_counters() const {
+    std::lock_guard<std::mutex> lk(m_mtx);
+    return m_counters;
+}
+
+std::map<std::string, t_metric_histogram>
+t_metrics::get_histograms() const {
+    std::lock_guard<std::mutex> lk(m_mtx);
+    return m_histograms;
+}
+
+std::string
+t_metrics::to_json() const {
+    std::lock_guard<std::mutex> lk(m_mtx);
+    std::stringstream ss;
+
+    ss << "{\"counters\":{";
+    bool first = true;
+    for (const auto& counter : m_counters) {
+        if (!first) {
+            ss << ",";
+        }
+        first = false;
+        write_json_string(ss, counter.first);
+        ss << ":" << counter.second;
+    }
+
+    ss << "},\"histograms\":{";
+    first = true;
+    for (const auto& histogram : m_histograms) {
+        const t_metric_histogram& h = histogram.second;
+        if (!first) {
+            ss << ",";
+        }
+        first = false;
+        write_json_string(ss, histogram.first);
+        ss << ":{\"count\":" << h.m_count << ",\"sum\":" << h.m_sum
+           << ",\"min\":" << h.m_min << ",\"max\":" << h.m_max
+           << ",\"mean\":" << h.mean() << ",\"p50\":" << h.percentile(0.5)
+           << ",\"p99\":" << h.percentile(0.99) << "}";
+    }
+
+    ss << "}}";
+    return ss.str();
+}
+
+std::string
+t_metrics::to_chrome_trace() const {
+    std::lock_guard<std::mutex> lk(m_mtx);
+
+    // Unroll the ring buffer, oldest record first.
+    std::vector<t_instrec> records;
+    records.reserve(m_trace.size());
+    records.insert(records.end(), m_trace.begin() + m_trace_head, m_trace.end());
+    records.insert(records.end(), m_trace.begin(), m_trace.begin() + m_trace_head);
+
+    return instrecs_to_chrome_trace(records.data(), records.size(), m_trace_names);
+}
+
+void
+t_metrics::reset() {
+    std::lock_guard<std::mutex> lk(m_mtx);
+    m_counters.clear();
+    m_histograms.clear();
+    m_trace_ids.clear();
+    m_trace_names.clear();
+    m_trace.clear();
+    m_trace_head = 0;
+}
+
+t_metrics_timer::t_metrics_timer(
+    t_metrics* metrics, const std::string& prefix, const char* stage)
+    : m_metrics(metrics != nullptr && metrics->is_enabled() ? metrics : nullptr)
+    , m_begin(0) {
+    if (m_metrics != nullptr) {
+        m_name = prefix + stage;
+        m_begin = now_ns();
+    }
+}
+
+t_metrics_timer::~t_metrics_timer() {
+    if (m_metrics != nullptr) {
+        m_metrics->record_duration(m_name, m_begin, now_ns());
+    }
+}
+
+std::string
+instrecs_to_chrome_trace(
+    const t_instrec* records, t_uindex nrecords, const std::vector<std::string>& names) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+
+    for (t_uindex idx = 0; idx < nrecords; ++idx) {
+        const t_instrec& rec = records[idx];
+        std::uint64_t id = rec.m_id;
+
+        if (idx > 0) {
+            ss << ",";
+        }
+
+        ss << "{\"name\":";
+        if (rec.m_trace_type == TRACE_TYPE_DURATION_TWO_SIDED) {
+            if (id < names.size()) {
+                write_json_string(ss, names[id]);
+            } else {
+                ss << "\"" << id << "\"";
+            }
+
+            std::uint64_t tid;
+            std::memcpy(&tid, rec.t_fntrace.m_payload, sizeof(tid));
+            ss << ",\"ph\":\"X\",\"dur\":" << rec.t_fntrace.m_duration / 1000.0
+               << ",\"tid\":" << tid;
+        } else {
+            const char* payload = rec.t_fixed_len.m_payload;
+            write_json_string(
+                ss, payload, strnlen(payload, sizeof(rec.t_fixed_len.m_payload)));
+
+            const char* phase = "i";
+            if (rec.m_trace_type == TRACE_TYPE_DURATION_ONE_SIDED_BEGIN) {
+                phase = "B";
+            } else if (rec.m_trace_type == TRACE_TYPE_DURATION_ONE_SIDED_END) {
+                phase = "E";
+            }
+
+            ss << ",\"ph\":\"" << phase << "\",\"tid\":0";
+        }
+
+        ss << ",\"ts\":" << rec.m_time / 1000.0 << ",\"pid\":0}";
+    }
+
+    ss << "]}";
+    return ss.str();
+}
+
+} // end namespace perspective
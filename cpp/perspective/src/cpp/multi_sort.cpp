@@ -12,6 +12,11 @@
 #include <perspective/base.h>
 #include <perspective/multi_sort.h>
 #include <perspective/scalar.h>
+#include <tsl/hopscotch_map.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
 #include <vector>
 
 namespace perspective {
@@ -226,4 +231,266 @@ t_multisorter::operator()(t_index a, t_index b) const {
     return this->operator()((*m_elems)[a], (*m_elems)[b]);
 }
 
+namespace {
+    // Order-preserving encodings of scalar values as unsigned integers, such
+    // that `a < b` implies `encode(a) < encode(b)`.
+    inline std::uint64_t
+    encode_signed(std::int64_t value) {
+        return static_cast<std::uint64_t>(value) ^ (std::uint64_t(1) << 63);
+    }
+
+    inline std::uint64_t
+    encode_double(double value) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits >> 63) ? ~bits : bits | (std::uint64_t(1) << 63);
+    }
+
+    std::uint64_t
+    encode_value(const t_tscalar& value) {
+        switch (value.get_dtype()) {
+            case DTYPE_INT64:
+            case DTYPE_TIME: return encode_signed(value.m_data.m_int64);
+            case DTYPE_INT32: return encode_signed(value.m_data.m_int32);
+            case DTYPE_INT16: return encode_signed(value.m_data.m_int16);
+            case DTYPE_INT8: return encode_signed(value.m_data.m_int8);
+            case DTYPE_UINT64:
+            case DTYPE_OBJECT: return value.m_data.m_uint64;
+            case DTYPE_UINT32:
+            case DTYPE_DATE: return value.m_data.m_uint32;
+            case DTYPE_UINT16: return value.m_data.m_uint16;
+            case DTYPE_UINT8: return value.m_data.m_uint8;
+            case DTYPE_BOOL: return value.m_data.m_bool ? 1 : 0;
+            case DTYPE_FLOAT64: return encode_double(value.m_data.m_float64);
+            case DTYPE_FLOAT32: return encode_double(value.m_data.m_float32);
+            default: return 0;
+        }
+    }
+
+    inline bool
+    is_nan(const t_tscalar& value) {
+        return value.is_floating_point() && std::isnan(value.to_double());
+    }
+
+    inline const char*
+    get_sort_char_ptr(const t_tscalar& value) {
+        const char* rval = value.get_char_ptr();
+        return rval == nullptr ? "" : rval;
+    }
+
+    // Write the rank of each string in column `cidx` among the distinct
+    // strings of the column into `out`, leaving other rows untouched.
+    void
+    rank_strings(const std::vector<t_mselem>& elems, t_uindex cidx,
+        std::vector<std::uint64_t>& out) {
+        tsl::hopscotch_map<const char*, t_uindex, t_cchar_umap_hash, t_cchar_umap_cmp> ids;
+        std::vector<const char*> distinct;
+        for (t_uindex idx = 0, loop_end = elems.size(); idx < loop_end; ++idx) {
+            const t_tscalar& value = elems[idx].m_row[cidx];
+            if (value.get_dtype() != DTYPE_STR)
+                continue;
+
+            const char* str = get_sort_char_ptr(value);
+            auto iter = ids.find(str);
+            if (iter == ids.end()) {
+                out[idx] = distinct.size();
+                ids[str] = distinct.size();
+                distinct.push_back(str);
+            } else {
+                out[idx] = iter->second;
+            }
+        }
+
+        std::vector<t_uindex> order(distinct.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&distinct](t_uindex a, t_uindex b) {
+            return std::strcmp(distinct[a], distinct[b]) < 0;
+        });
+
+        std::vector<std::uint64_t> ranks(distinct.size());
+        for (t_uindex rank = 0, loop_end = order.size(); rank < loop_end; ++rank) {
+            ranks[order[rank]] = rank;
+        }
+
+        for (t_uindex idx = 0, loop_end = elems.size(); idx < loop_end; ++idx) {
+            if (elems[idx].m_row[cidx].get_dtype() == DTYPE_STR) {
+                out[idx] = ranks[out[idx]];
+            }
+        }
+    }
+
+    /**
+     * @brief Append the key words for column `cidx` to `keys`, most
+     * significant first. Returns false if sorting on this column may
+     * consider anything but its own values, after which no further columns
+     * can be encoded.
+     */
+    bool
+    encode_sort_column(const std::vector<t_mselem>& elems, t_uindex cidx, t_sorttype order,
+        std::vector<std::vector<std::uint64_t>>& keys) {
+        t_uindex nelems = elems.size();
+        bool has_nan = false;
+        bool has_non_float = false;
+        bool tags_vary = false;
+        std::uint64_t first_tag = 0;
+
+        // `cmp_mselem` compares scalars by type, then status, then value,
+        // except that NaN is ordered first (or last if descending).
+        auto get_tag = [](const t_tscalar& value) {
+            return (std::uint64_t(value.m_type) << 8) | std::uint64_t(value.m_status);
+        };
+
+        for (t_uindex idx = 0; idx < nelems; ++idx) {
+            const t_tscalar& value = elems[idx].m_row[cidx];
+            has_nan = has_nan || is_nan(value);
+            has_non_float = has_non_float || !value.is_floating_point();
+            std::uint64_t tag = get_tag(value);
+            if (idx == 0) {
+                first_tag = tag;
+            } else if (tag != first_tag) {
+                tags_vary = true;
+            }
+        }
+
+        // NaN is only ordered specially against floating point values, and
+        // unsorted columns order by primary key.
+        if ((has_nan && has_non_float) || order == SORTTYPE_NONE)
+            return false;
+
+        bool descending = order == SORTTYPE_DESCENDING || order == SORTTYPE_DESCENDING_ABS;
+        bool absolute = order == SORTTYPE_ASCENDING_ABS || order == SORTTYPE_DESCENDING_ABS;
+        const std::uint64_t nan_flag = std::uint64_t(1) << 16;
+
+        if (has_nan || (tags_vary && !absolute)) {
+            std::vector<std::uint64_t> tags(nelems);
+            for (t_uindex idx = 0; idx < nelems; ++idx) {
+                const t_tscalar& value = elems[idx].m_row[cidx];
+                if (is_nan(value)) {
+                    tags[idx] = descending ? nan_flag : 0;
+                } else if (absolute) {
+                    tags[idx] = descending ? 0 : nan_flag;
+                } else {
+                    std::uint64_t tag = get_tag(value);
+                    tags[idx] = descending ? 0xFFFF - tag : nan_flag | tag;
+                }
+            }
+
+            keys.push_back(std::move(tags));
+        }
+
+        std::vector<std::uint64_t> values(nelems, 0);
+        if (!absolute) {
+            rank_strings(elems, cidx, values);
+        }
+
+        for (t_uindex idx = 0; idx < nelems; ++idx) {
+            const t_tscalar& value = elems[idx].m_row[cidx];
+            std::uint64_t encoded;
+            if (is_nan(value)) {
+                encoded = 0;
+            } else if (absolute) {
+                encoded = encode_double(std::abs(value.to_double()));
+            } else if (value.get_dtype() == DTYPE_STR) {
+                encoded = values[idx];
+            } else {
+                encoded = encode_value(value);
+            }
+
+            values[idx] = descending ? ~encoded : encoded;
+        }
+
+        keys.push_back(std::move(values));
+
+        // Absolute sorts break ties between unequal values by primary key
+        return !absolute;
+    }
+} // namespace
+
+std::vector<t_uindex>
+multisort_indices(const std::vector<t_mselem>& elems, const std::vector<t_sorttype>& sort_order) {
+    t_uindex nelems = elems.size();
+    std::vector<t_uindex> rval(nelems);
+    std::iota(rval.begin(), rval.end(), 0);
+
+    for (const t_mselem& elem : elems) {
+        if (elem.m_row.size() != sort_order.size()) {
+            std::cout << "ERROR detected in MultiSort." << std::endl;
+            return rval;
+        }
+    }
+
+    std::vector<std::vector<std::uint64_t>> keys;
+    for (t_uindex cidx = 0, loop_end = sort_order.size(); cidx < loop_end; ++cidx) {
+        if (!encode_sort_column(elems, cidx, sort_order[cidx], keys))
+            break;
+    }
+
+    // LSD radix sort over the key words, least significant first, one byte
+    // at a time, skipping bytes which are the same for every row.
+    std::vector<t_uindex> scratch(nelems);
+    std::vector<t_uindex> counts(8 * 256);
+    for (auto key = keys.rbegin(); key != keys.rend(); ++key) {
+        const std::vector<std::uint64_t>& words = *key;
+        std::fill(counts.begin(), counts.end(), 0);
+        for (std::uint64_t word : words) {
+            for (t_uindex byte = 0; byte < 8; ++byte) {
+                ++counts[byte * 256 + ((word >> (byte * 8)) & 0xFF)];
+            }
+        }
+
+        for (t_uindex byte = 0; byte < 8; ++byte) {
+            t_uindex* offsets = &counts[byte * 256];
+            if (std::any_of(offsets, offsets + 256, [nelems](t_uindex c) { return c == nelems; }))
+                continue;
+
+            t_uindex total = 0;
+            for (t_uindex bucket = 0; bucket < 256; ++bucket) {
+                t_uindex count = offsets[bucket];
+                offsets[bucket] = total;
+                total += count;
+            }
+
+            for (t_uindex idx : rval) {
+                scratch[offsets[(words[idx] >> (byte * 8)) & 0xFF]++] = idx;
+            }
+
+            std::swap(rval, scratch);
+        }
+    }
+
+    // Order runs of equal keys by the full comparison
+    auto keys_equal = [&keys](t_uindex a, t_uindex b) {
+        for (const std::vector<std::uint64_t>& words : keys) {
+            if (words[a] != words[b])
+                return false;
+        }
+        return true;
+    };
+
+    t_multisorter sorter(sort_order);
+    auto by_elem
+        = [&elems, &sorter](t_uindex a, t_uindex b) { return sorter(elems[a], elems[b]); };
+
+    t_uindex run_begin = 0;
+    for (t_uindex idx = 1; idx <= nelems; ++idx) {
+        if (idx == nelems || !keys_equal(rval[idx - 1], rval[idx])) {
+            if (idx - run_begin > 1) {
+                std::sort(rval.begin() + run_begin, rval.begin() + idx, by_elem);
+            }
+            run_begin = idx;
+        }
+    }
+
+#ifdef PSP_VERIFY
+    // Incremental inserts into the sorted index use `cmp_mselem`, so the
+    // permutation must agree with it exactly.
+    for (t_uindex idx = 1; idx < nelems; ++idx) {
+        PSP_VERBOSE_ASSERT(!by_elem(rval[idx], rval[idx - 1]),
+            "multisort_indices disagrees with cmp_mselem");
+    }
+#endif
+
+    return rval;
+}
+
 } // end namespace perspective
@@ -13,7 +13,7 @@
 #include <perspective/update_task.h>
 #include <perspective/compat.h>
 #include <perspective/env_vars.h>
-#ifdef PSP_ENABLE_PYTHON
+#ifndef PSP_ENABLE_WASM
 #include <thread>
 #endif
 #include <chrono>
@@ -37,7 +37,8 @@ empty_callback() {
 
 t_pool::t_pool()
     : m_update_delegate(empty_callback()) 
-    , m_sleep(0) {
+    , m_sleep(0)
+    , m_metrics(std::make_shared<t_metrics>()) {
         m_run.clear();
     }
 
@@ -51,20 +52,30 @@ empty_callback() {
 t_pool::t_pool()
     : m_update_delegate(empty_callback())
     , m_event_loop_thread_id(std::thread::id())
-    , m_sleep(0) {
+    , m_sleep(0)
+    , m_engine_running(false)
+    , m_engine_interval(0)
+    , m_metrics(std::make_shared<t_metrics>()) {
         m_run.clear();
     }
 
 #else
 
 t_pool::t_pool()
-    : m_sleep(0) {
+    : m_sleep(0)
+    , m_engine_running(false)
+    , m_engine_interval(0)
+    , m_metrics(std::make_shared<t_metrics>()) {
         m_run.clear();
     }
 
 #endif
 
-t_pool::~t_pool() {}
+t_pool::~t_pool() {
+#ifndef PSP_ENABLE_WASM
+    stop_engine();
+#endif
+}
 
 void
 t_pool::init() {
@@ -80,12 +91,13 @@ t_pool::init() {
 
 t_uindex
 t_pool::register_gnode(t_gnode* node) {
-    std::lock_guard<std::mutex> lg(m_mtx);
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
 
     m_gnodes.push_back(node);
     t_uindex id = m_gnodes.size() - 1;
     node->set_id(id);
     node->set_pool_cleanup([this, id]() { this->m_gnodes[id] = 0; });
+    node->set_metrics(m_metrics);
 #ifdef PSP_ENABLE_PYTHON
     if (m_event_loop_thread_id != std::thread::id()) {
         node->set_event_loop_thread_id(m_event_loop_thread_id);
@@ -101,7 +113,7 @@ t_pool::register_gnode(t_gnode* node) {
 
 void
 t_pool::unregister_gnode(t_uindex idx) {
-    std::lock_guard<std::mutex> lgxo(m_mtx);
+    std::lock_guard<std::recursive_mutex> lgxo(m_mtx);
 
     if (t_env::log_progress()) {
         std::cout << "t_pool.unregister_gnode idx => " << idx << std::endl;
@@ -112,24 +124,38 @@ t_pool::unregister_gnode(t_uindex idx) {
 
 void
 t_pool::send(t_uindex gnode_id, t_uindex port_id, const t_data_table& table) {
-    {
-        std::lock_guard<std::mutex> lg(m_mtx);
-        m_data_remaining.store(true);
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
+    t_gnode* gnode = _get_send_gnode(gnode_id, port_id, table);
+    if (gnode) {
+        gnode->send(port_id, table);
+    }
+}
 
-        if (m_gnodes[gnode_id]) {
-            m_gnodes[gnode_id]->send(port_id, table);
-        }
+void
+t_pool::send(t_uindex gnode_id, t_uindex port_id, t_data_table&& table) {
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
+    t_gnode* gnode = _get_send_gnode(gnode_id, port_id, table);
+    if (gnode) {
+        gnode->send(port_id, std::move(table));
+    }
+}
 
-        if (t_env::log_progress()) {
-            std::cout << "t_pool.send gnode_id => " << gnode_id << " port_id => " << port_id
-                      << " tbl_size => " << table.size() << std::endl;
-        }
+t_gnode*
+t_pool::_get_send_gnode(t_uindex gnode_id, t_uindex port_id, const t_data_table& table) {
+    m_data_remaining.store(true);
 
-        if (t_env::log_data_pool_send()) {
-            std::cout << "t_pool.send" << std::endl;
-            table.pprint();
-        }
+    // Log before sending, as the port may take the columns of `table`.
+    if (t_env::log_progress()) {
+        std::cout << "t_pool.send gnode_id => " << gnode_id << " port_id => " << port_id
+                  << " tbl_size => " << table.size() << std::endl;
+    }
+
+    if (t_env::log_data_pool_send()) {
+        std::cout << "t_pool.send" << std::endl;
+        table.pprint();
     }
+
+    return m_gnodes[gnode_id];
 }
 
 #ifdef PSP_ENABLE_PYTHON
@@ -154,6 +180,183 @@ t_pool::_process() {
     }
 }
 
+#ifndef PSP_ENABLE_WASM
+void
+t_pool::start_engine(t_uindex interval_ms) {
+#ifdef PSP_ENABLE_PYTHON
+    PSP_VERBOSE_ASSERT(m_event_loop_thread_id == std::thread::id(),
+        "The engine thread cannot be started on a pool with an event loop.");
+#endif
+    m_engine_interval.store(interval_ms);
+
+    if (m_engine_running.exchange(true)) {
+        return;
+    }
+
+    if (t_env::log_progress()) {
+        std::cout << "t_pool.start_engine interval_ms => " << interval_ms << std::endl;
+    }
+
+    m_engine_thread = std::thread(&t_pool::_engine_loop, this);
+    set_thread_name(m_engine_thread, "psp_engine_thread");
+}
+
+void
+t_pool::stop_engine() {
+    {
+        std::lock_guard<std::mutex> lk(m_engine_mtx);
+        if (!m_engine_running.exchange(false)) {
+            return;
+        }
+    }
+
+    m_engine_cv.notify_one();
+
+#ifdef PSP_ENABLE_PYTHON
+    // The engine thread takes the GIL to notify userspace, so it must not be
+    // held while waiting for the thread to finish.
+    if (PyGILState_Check()) {
+        py::gil_scoped_release release;
+        m_engine_thread.join();
+        return;
+    }
+#endif
+
+    m_engine_thread.join();
+
+    if (t_env::log_progress()) {
+        std::cout << "t_pool.stop_engine" << std::endl;
+    }
+}
+
+bool
+t_pool::is_engine_running() const {
+    return m_engine_running.load();
+}
+
+void
+t_pool::enqueue(t_uindex gnode_id, t_uindex port_id, std::shared_ptr<t_data_table> table) {
+    if (t_env::log_progress()) {
+        std::cout << "t_pool.enqueue gnode_id => " << gnode_id << " port_id => " << port_id
+                  << " tbl_size => " << table->size() << std::endl;
+    }
+
+    m_engine_queue.push({gnode_id, port_id, std::move(table)});
+
+    // Without a cadence the engine thread sleeps until woken. Taking the
+    // engine mutex orders the push before its wait, so the wake is not lost.
+    if (m_engine_interval.load() == 0) {
+        { std::lock_guard<std::mutex> lk(m_engine_mtx); }
+        m_engine_cv.notify_one();
+    }
+}
+
+void
+t_pool::_engine_loop() {
+    // Milliseconds until a batch held back by its gnode's batch policy is due
+    t_uindex deferred_ms = 0;
+
+    while (m_engine_running.load()) {
+        bool has_fragments;
+
+        {
+            std::unique_lock<std::mutex> lk(m_engine_mtx);
+            t_uindex interval = m_engine_interval.load();
+            auto wake = [this]() {
+                return !m_engine_running.load() || !m_engine_queue.empty();
+            };
+
+            if (interval > 0) {
+                m_engine_cv.wait_for(lk, std::chrono::milliseconds(interval),
+                    [this]() { return !m_engine_running.load(); });
+            } else if (deferred_ms > 0) {
+                m_engine_cv.wait_for(lk, std::chrono::milliseconds(deferred_ms), wake);
+            } else {
+                m_engine_cv.wait(lk, wake);
+            }
+
+            has_fragments = !m_engine_queue.empty();
+        }
+
+        if (has_fragments || deferred_ms > 0) {
+            deferred_ms = _process_engine_queue(false);
+        }
+    }
+
+    // Process whatever was queued before `stop_engine`
+    _process_engine_queue(true);
+}
+
+t_uindex
+t_pool::_process_engine_queue(bool flush) {
+    std::vector<t_fragment> fragments;
+    m_engine_queue.drain(fragments);
+
+    std::vector<t_uindex> updated_ports;
+    t_uindex deferred_ms;
+
+    {
+        std::lock_guard<std::recursive_mutex> lg(m_mtx);
+
+        // Fragments for the same port are appended to its input table in
+        // the order they were queued, so each port is processed once.
+        for (const auto& fragment : fragments) {
+            if (fragment.m_gnode_id < m_gnodes.size() && m_gnodes[fragment.m_gnode_id]) {
+                m_gnodes[fragment.m_gnode_id]->send(
+                    fragment.m_port_id, std::move(*fragment.m_table));
+            }
+        }
+
+        t_update_task task(*this);
+        deferred_ms = task.run(&updated_ports, flush);
+    }
+
+    if (updated_ports.empty()) {
+        return deferred_ms;
+    }
+
+    // Notify after releasing the pool lock, so callbacks can use the pool
+#ifdef PSP_ENABLE_PYTHON
+    py::gil_scoped_acquire acquire;
+#endif
+    try {
+        for (auto port_id : updated_ports) {
+            notify_userspace(port_id);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Update callback failed on the engine thread: " << e.what() << std::endl;
+    }
+
+    return deferred_ms;
+}
+
+void
+t_pool::set_batch_policy(t_uindex gnode_id, const t_batch_policy& policy) {
+    PSP_VERBOSE_ASSERT(m_engine_running.load(),
+        "A batch policy is only honored by the engine thread - call `start_engine` first.");
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
+    if (!validate_gnode_id(gnode_id))
+        return;
+    m_gnodes[gnode_id]->set_batch_policy(policy);
+}
+
+t_batch_stats
+t_pool::get_batch_stats(t_uindex gnode_id) {
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
+    if (!validate_gnode_id(gnode_id))
+        return t_batch_stats();
+    return m_gnodes[gnode_id]->get_batch_stats();
+}
+#endif
+
+void
+t_pool::set_shrink_policy(t_uindex gnode_id, const t_shrink_policy& policy) {
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
+    if (!validate_gnode_id(gnode_id))
+        return;
+    m_gnodes[gnode_id]->set_shrink_policy(policy);
+}
+
 void
 t_pool::stop() {
     m_run.clear(std::memory_order_release);
@@ -193,7 +396,7 @@ t_pool::get_trees() {
 void
 t_pool::register_context(
     t_uindex gnode_id, const std::string& name, t_ctx_type type, std::int32_t ptr) {
-    std::lock_guard<std::mutex> lg(m_mtx);
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
     if (!validate_gnode_id(gnode_id))
         return;
     m_gnodes[gnode_id]->_register_context(name, type, ptr);
@@ -203,7 +406,7 @@ t_pool::register_context(
 void
 t_pool::register_context(
     t_uindex gnode_id, const std::string& name, t_ctx_type type, std::int64_t ptr) {
-    std::lock_guard<std::mutex> lg(m_mtx);
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
     if (!validate_gnode_id(gnode_id))
         return;
     m_gnodes[gnode_id]->_register_context(name, type, ptr);
@@ -230,7 +433,7 @@ t_pool::notify_userspace(t_uindex port_id) {
 
 void
 t_pool::unregister_context(t_uindex gnode_id, const std::string& name) {
-    std::lock_guard<std::mutex> lg(m_mtx);
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
 
     if (t_env::log_progress()) {
         std::cout << repr() << " << t_pool.unregister_context: "
@@ -250,7 +453,7 @@ t_pool::get_data_remaining() const {
 
 std::vector<t_tscalar>
 t_pool::get_row_data_pkeys(t_uindex gnode_id, const std::vector<t_tscalar>& pkeys) {
-    std::lock_guard<std::mutex> lg(m_mtx);
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
 
     if (!validate_gnode_id(gnode_id))
         return std::vector<t_tscalar>();
@@ -268,15 +471,18 @@ t_pool::get_row_data_pkeys(t_uindex gnode_id, const std::vector<t_tscalar>& pkey
 
 std::vector<t_updctx>
 t_pool::get_contexts_last_updated() {
-    std::lock_guard<std::mutex> lg(m_mtx);
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
     std::vector<t_updctx> rval;
 
+    // Only contexts that had deltas when notified are published, so this
+    // scales with the number of updated contexts, not registered contexts.
     for (t_uindex idx = 0, loop_end = m_gnodes.size(); idx < loop_end; ++idx) {
-        if (!m_gnodes[idx])
+        if (!m_gnodes[idx] || !m_gnodes[idx]->has_contexts_last_updated())
             continue;
 
         auto updated_contexts = m_gnodes[idx]->get_contexts_last_updated();
         auto gnode_id = m_gnodes[idx]->get_id();
+        m_gnodes[idx]->clear_contexts_last_updated();
 
         for (const auto& ctx_name : updated_contexts) {
             if (t_env::log_progress()) {
@@ -319,6 +525,11 @@ t_pool::pprint_registered() const {
     }
 }
 
+std::shared_ptr<t_metrics>
+t_pool::get_metrics() const {
+    return m_metrics;
+}
+
 t_uindex
 t_pool::epoch() const {
     return m_epoch.load();
@@ -331,7 +542,7 @@ t_pool::inc_epoch() {
 
 std::vector<t_uindex>
 t_pool::get_gnodes_last_updated() {
-    std::lock_guard<std::mutex> lg(m_mtx);
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
     std::vector<t_uindex> rv;
 
     for (t_uindex idx = 0, loop_end = m_gnodes.size(); idx < loop_end; ++idx) {
@@ -344,9 +555,14 @@ t_pool::get_gnodes_last_updated() {
     return rv;
 }
 
+std::unique_lock<std::recursive_mutex>
+t_pool::lock() {
+    return std::unique_lock<std::recursive_mutex>(m_mtx);
+}
+
 t_gnode*
 t_pool::get_gnode(t_uindex idx) {
-    std::lock_guard<std::mutex> lg(m_mtx);
+    std::lock_guard<std::recursive_mutex> lg(m_mtx);
     PSP_VERBOSE_ASSERT(idx < m_gnodes.size() && m_gnodes[idx], "Bad gnode encountered");
     return m_gnodes[idx];
 }
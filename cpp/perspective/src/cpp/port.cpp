@@ -52,6 +52,17 @@ t_port::send(const t_data_table& table) {
     m_table->append(table);
 }
 
+void
+t_port::send(t_data_table&& table) {
+    // An empty port has nothing to append to, so take the incoming columns
+    // instead of copying them; `table` is left with the port's empty ones.
+    if (m_table->size() == 0 && m_table->swap_columns(table)) {
+        return;
+    }
+
+    m_table->append(table);
+}
+
 t_schema
 t_port::get_schema() const {
     return m_schema;
@@ -100,4 +111,13 @@ t_port::clear() {
     m_table->clear();
 }
 
+t_uindex
+t_port::get_memory_usage() const {
+    if (!m_table) {
+        return 0;
+    }
+
+    return m_table->get_memory_usage();
+}
+
 } // end namespace perspective
@@ -688,21 +688,18 @@ t_tscalar::to_string(bool for_expr) const {
             std::chrono::milliseconds timestamp(to_int64());
             date::sys_time<std::chrono::milliseconds> ts(timestamp);
             std::time_t temp = std::chrono::system_clock::to_time_t(ts);
-            std::tm* t = std::localtime(&temp);
-
-            // use a mix of strftime and date::format
-            std::string buffer;
-            buffer.resize(64);
-            
-            // write y-m-d h:m in local time into buffer, and if successful
-            // write the rest of the date, otherwise print the date in UTC.
-            std::size_t len = strftime(&buffer[0], buffer.size(), "%Y-%m-%d %H:%M:", t);
-            if (len > 0) {
-                buffer.resize(len);
+            std::tm t;
+
+            // write y-m-d h:m in local time, and if successful write the
+            // rest of the date, otherwise print the date in UTC.
+            if (local_tm(temp, t)) {
+                char buffer[64];
+                snprintf(buffer, sizeof(buffer), "%d-%02d-%02d %02d:%02d:",
+                    t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min);
                 ss << buffer;
                 ss << date::format("%S", ts); // represent second and millisecond
             } else {
-                std::cerr << to_int64() << " failed strftime" << std::endl;
+                std::cerr << to_int64() << " failed localtime" << std::endl;
                 ss << date::format("%Y-%m-%d %H:%M:%S UTC", ts);
             }
 
@@ -63,6 +63,76 @@ get_dominant(std::vector<t_tscalar>& values) {
     return delem;
 }
 
+t_value_counts::t_value_counts()
+    : m_nfalse(0)
+    , m_nnan(0)
+    , m_joined(mknone())
+    , m_joined_stale(true) {}
+
+void
+t_value_counts::add(const t_tscalar& value) {
+    if (!value) {
+        ++m_nfalse;
+    }
+
+    if (value.is_nan()) {
+        ++m_nnan;
+        return;
+    }
+
+    t_uindex& count = m_counts[value];
+    if (count == 0) {
+        m_joined_stale = true;
+    }
+
+    ++count;
+}
+
+void
+t_value_counts::remove(const t_tscalar& value) {
+    if (!value) {
+        --m_nfalse;
+    }
+
+    if (value.is_nan()) {
+        --m_nnan;
+        return;
+    }
+
+    auto iter = m_counts.find(value);
+    PSP_VERBOSE_ASSERT(iter != m_counts.end(), "Removing uncounted value");
+
+    if (--iter->second == 0) {
+        m_counts.erase(iter);
+        m_joined_stale = true;
+    }
+}
+
+bool
+t_value_counts::empty() const {
+    return m_counts.empty() && m_nnan == 0;
+}
+
+t_tscalar
+t_value_counts::get_dominant() const {
+    if (m_counts.empty())
+        return mknone();
+
+    // `get_dominant` only counts repeats of valid values, and otherwise
+    // returns the least value.
+    auto dominant = m_counts.begin();
+    t_uindex dcount = 1;
+
+    for (auto iter = m_counts.begin(); iter != m_counts.end(); ++iter) {
+        if (iter->second > dcount && iter->first.is_valid()) {
+            dominant = iter;
+            dcount = iter->second;
+        }
+    }
+
+    return dominant->first;
+}
+
 t_tree_unify_rec::t_tree_unify_rec(
     t_uindex sptidx, t_uindex daggidx, t_uindex saggidx, t_uindex nstrands)
     : m_sptidx(sptidx)
@@ -136,6 +206,33 @@ t_stree::init() {
         m_aggcols[idx] = m_aggregates->get_const_column(columns[idx]).get();
     }
 
+    m_counted_columns.clear();
+    for (const auto& spec : m_aggspecs) {
+        switch (spec.agg()) {
+            case AGGTYPE_DOMINANT:
+            case AGGTYPE_UNIQUE:
+            case AGGTYPE_AND:
+            case AGGTYPE_JOIN: {
+                const auto& deps = spec.get_dependencies();
+                if (deps.empty() || deps[0].type() != DEPTYPE_COLUMN) {
+                    break;
+                }
+
+                const std::string& depname = deps[0].name();
+                if (std::find(m_counted_columns.begin(), m_counted_columns.end(), depname)
+                    == m_counted_columns.end()) {
+                    m_counted_columns.push_back(depname);
+                }
+            } break;
+            default:
+                break;
+        }
+    }
+
+    m_value_counts = std::vector<t_node_value_counts>(m_counted_columns.size());
+    m_counted_rows.clear();
+    m_counted_updates.clear();
+
     m_deltas = std::make_shared<t_tcdeltas>();
     m_features = std::vector<bool>(CTX_FEAT_LAST_FEATURE);
     m_init = true;
@@ -577,6 +674,14 @@ t_stree::populate_pkey_idx(const t_dtree_ctx& ctx, const t_dtree& dtree, t_uinde
             if (strand_count < 0) {
                 remove_pkey(sptidx, pkey);
             }
+
+            if (!m_counted_columns.empty()) {
+                if (strand_count >= 0) {
+                    m_counted_updates[pkey] = sptidx;
+                } else {
+                    m_counted_updates.insert(std::make_pair(pkey, INVALID_INDEX));
+                }
+            }
         }
     }
 }
@@ -698,9 +803,113 @@ t_stree::update_shape_from_static(const t_dtree_ctx& ctx) {
         m_idxpkey->insert(s);
     }
 
+    unapply_value_counts();
     mark_zero_desc();
 }
 
+void
+t_stree::unapply_value_counts() {
+    for (const auto& update : m_counted_updates) {
+        auto row_iter = m_counted_rows.find(update.first);
+        if (row_iter == m_counted_rows.end()) {
+            continue;
+        }
+
+        const t_counted_row& row = row_iter->second;
+
+        if (node_exists(row.m_leaf)) {
+            for (auto nidx : get_ancestry(row.m_leaf)) {
+                for (t_uindex cidx = 0, loop_end = m_value_counts.size(); cidx < loop_end;
+                     ++cidx) {
+                    t_node_value_counts& node_counts = m_value_counts[cidx];
+                    if (node_counts.find(nidx) == node_counts.end()) {
+                        continue;
+                    }
+
+                    t_value_counts& counts = node_counts[nidx];
+                    counts.remove(row.m_values[cidx]);
+                    if (counts.empty()) {
+                        node_counts.erase(nidx);
+                    }
+                }
+            }
+        }
+
+        m_counted_rows.erase(row_iter);
+    }
+}
+
+void
+t_stree::apply_value_counts(const t_gstate& gstate) {
+    std::vector<t_tscalar> pkeys;
+    std::vector<t_uindex> leaves;
+    pkeys.reserve(m_counted_updates.size());
+    leaves.reserve(m_counted_updates.size());
+
+    for (const auto& update : m_counted_updates) {
+        if (update.second == INVALID_INDEX || !node_exists(update.second)) {
+            continue;
+        }
+
+        pkeys.push_back(update.first);
+        leaves.push_back(update.second);
+    }
+
+    m_counted_updates.clear();
+
+    if (pkeys.empty()) {
+        return;
+    }
+
+    t_uindex ncols = m_counted_columns.size();
+    std::vector<std::vector<t_tscalar>> values(ncols);
+    for (t_uindex cidx = 0; cidx < ncols; ++cidx) {
+        gstate.read_column(m_counted_columns[cidx], pkeys, values[cidx]);
+    }
+
+    // Rows of an update are mostly spread over few leaves.
+    tsl::hopscotch_map<t_uindex, std::vector<t_uindex>> ancestries;
+
+    for (t_uindex idx = 0, loop_end = pkeys.size(); idx < loop_end; ++idx) {
+        t_uindex leaf = leaves[idx];
+        if (ancestries.find(leaf) == ancestries.end()) {
+            ancestries[leaf] = get_ancestry(leaf);
+        }
+
+        const std::vector<t_uindex>& ancestry = ancestries[leaf];
+
+        t_counted_row row;
+        row.m_leaf = leaf;
+        row.m_values.resize(ncols);
+
+        for (t_uindex cidx = 0; cidx < ncols; ++cidx) {
+            t_tscalar value = m_symtable.get_interned_tscalar(values[cidx][idx]);
+            row.m_values[cidx] = value;
+
+            t_node_value_counts& node_counts = m_value_counts[cidx];
+            for (auto nidx : ancestry) {
+                node_counts[nidx].add(value);
+            }
+        }
+
+        m_counted_rows[pkeys[idx]] = std::move(row);
+    }
+}
+
+t_value_counts*
+t_stree::get_value_counts(const t_agg_update_info& info, t_uindex idx, t_uindex nidx) {
+    t_node_value_counts* node_counts = info.m_value_counts[idx];
+    if (node_counts == nullptr) {
+        return nullptr;
+    }
+
+    if (node_counts->find(nidx) == node_counts->end()) {
+        return &m_empty_counts;
+    }
+
+    return &(*node_counts)[nidx];
+}
+
 void
 t_stree::mark_zero_desc() {
     auto zeros = zero_strands();
@@ -730,8 +939,22 @@ t_stree::update_aggs_from_static(const t_dtree_ctx& ctx, const t_gstate& gstate)
         agg_update_info.m_src.push_back(src_aggtable.get_const_column(colname).get());
         agg_update_info.m_dst.push_back(m_aggregates->get_column(colname).get());
         agg_update_info.m_aggspecs.push_back(ctx.get_aggspec(colname));
+
+        const t_aggspec& spec = agg_update_info.m_aggspecs.back();
+        t_node_value_counts* node_counts = nullptr;
+        if (!spec.get_dependencies().empty()) {
+            auto iter = std::find(m_counted_columns.begin(), m_counted_columns.end(),
+                spec.get_dependencies()[0].name());
+            if (iter != m_counted_columns.end()) {
+                node_counts = &m_value_counts[iter - m_counted_columns.begin()];
+            }
+        }
+
+        agg_update_info.m_value_counts.push_back(node_counts);
     }
 
+    apply_value_counts(gstate);
+
     auto is_col_scaled_aggregate = [&](int col_idx) -> bool {
         int agg_type = agg_update_info.m_aggspecs[col_idx].agg();
 
@@ -816,6 +1039,36 @@ t_stree::size() const {
     return m_nodes->size();
 }
 
+void
+t_stree::get_memory_usage(t_memory_usage& usage) const {
+    // `t_treenodes` has five indices over each node.
+    usage["tree"] += node_memory_usage(*m_nodes, 5) + node_memory_usage(*m_idxpkey)
+        + node_memory_usage(*m_idxleaf) + node_memory_usage(m_smap)
+        + node_memory_usage(m_newids) + node_memory_usage(m_newleaves)
+        + vector_memory_usage(m_agg_freelist);
+
+    if (m_aggregates) {
+        usage["aggregates"] += m_aggregates->get_memory_usage();
+    }
+
+    usage["aggregates"]
+        += hash_memory_usage(m_counted_rows) + hash_memory_usage(m_counted_updates);
+    for (const auto& row : m_counted_rows) {
+        usage["aggregates"] += vector_memory_usage(row.second.m_values);
+    }
+
+    for (const auto& node_counts : m_value_counts) {
+        usage["aggregates"] += hash_memory_usage(node_counts);
+        for (const auto& counts : node_counts) {
+            usage["aggregates"] += node_memory_usage(counts.second.m_counts);
+        }
+    }
+
+    usage["deltas"] += node_memory_usage(*m_deltas)
+        + vector_memory_usage(m_tree_unification_records);
+    usage["symtable"] += m_symtable.get_memory_usage();
+}
+
 void
 t_stree::get_child_nodes(t_uindex idx, t_tnodevec& nodes) const {
     t_index num_children = get_num_children(idx);
@@ -944,11 +1197,19 @@ t_stree::update_agg_table(t_uindex nidx, t_agg_update_info& info, t_uindex src_r
                 new_value.set(nr / dr);
             } break;
             case AGGTYPE_UNIQUE: {
-                auto pkeys = get_pkeys(nidx);
                 old_value.set(dst->get_scalar(dst_ridx));
 
-                bool is_unique
-                    = gstate.is_unique(pkeys, spec.get_dependencies()[0].name(), new_value);
+                bool is_unique;
+                const t_value_counts* counts = get_value_counts(info, idx, nidx);
+                if (counts != nullptr && counts->m_nnan == 0) {
+                    is_unique = counts->m_counts.size() <= 1;
+                    new_value
+                        = counts->m_counts.empty() ? mknone() : counts->m_counts.begin()->first;
+                } else {
+                    auto pkeys = get_pkeys(nidx);
+                    is_unique
+                        = gstate.is_unique(pkeys, spec.get_dependencies()[0].name(), new_value);
+                }
 
                 if (new_value.m_type == DTYPE_STR) {
                     if (is_unique) {
@@ -1006,6 +1267,23 @@ t_stree::update_agg_table(t_uindex nidx, t_agg_update_info& info, t_uindex src_r
             } break;
             case AGGTYPE_JOIN: {
                 old_value.set(dst->get_scalar(dst_ridx));
+
+                t_value_counts* counts = get_value_counts(info, idx, nidx);
+                if (counts != nullptr && counts->m_nnan == 0) {
+                    if (counts->m_joined_stale) {
+                        std::stringstream ss;
+                        for (const auto& count : counts->m_counts) {
+                            ss << count.first << ", ";
+                        }
+                        counts->m_joined = m_symtable.get_interned_tscalar(ss.str().c_str());
+                        counts->m_joined_stale = false;
+                    }
+
+                    new_value.set(counts->m_joined);
+                    dst->set_scalar(dst_ridx, new_value);
+                    break;
+                }
+
                 auto pkeys = get_pkeys(nidx);
 
                 new_value.set(gstate.reduce<std::function<t_tscalar(std::vector<t_tscalar>&)>>(
@@ -1073,6 +1351,14 @@ t_stree::update_agg_table(t_uindex nidx, t_agg_update_info& info, t_uindex src_r
             } break;
             case AGGTYPE_DOMINANT: {
                 old_value.set(dst->get_scalar(dst_ridx));
+
+                const t_value_counts* counts = get_value_counts(info, idx, nidx);
+                if (counts != nullptr && counts->m_nnan == 0) {
+                    new_value.set(counts->get_dominant());
+                    dst->set_scalar(dst_ridx, new_value);
+                    break;
+                }
+
                 auto pkeys = get_pkeys(nidx);
 
                 new_value.set(gstate.reduce<std::function<t_tscalar(std::vector<t_tscalar>&)>>(
@@ -1089,6 +1375,14 @@ t_stree::update_agg_table(t_uindex nidx, t_agg_update_info& info, t_uindex src_r
             } break;
             case AGGTYPE_AND: {
                 old_value.set(dst->get_scalar(dst_ridx));
+
+                const t_value_counts* counts = get_value_counts(info, idx, nidx);
+                if (counts != nullptr) {
+                    new_value.set(counts->m_nfalse == 0);
+                    dst->set_scalar(dst_ridx, new_value);
+                    break;
+                }
+
                 auto pkeys = get_pkeys(nidx);
 
                 new_value.set(
@@ -1436,6 +1730,10 @@ t_stree::drop_zero_strands() {
         if (iter->m_depth == lst)
             leaves.push_back(iter->m_idx);
         node_ids.push_back(iter->m_aggidx);
+
+        for (auto& node_counts : m_value_counts) {
+            node_counts.erase(iter->m_idx);
+        }
     }
 
     clear_aggregates(node_ids);
@@ -1832,6 +2130,22 @@ t_stree::insert_node(const t_tnode& node) {
     return m_nodes->insert(node);
 }
 
+bool
+t_stree::update_node(const t_tnode& node) {
+    iter_by_idx iter = m_nodes->get<by_idx>().find(node.m_idx);
+    if (iter == m_nodes->get<by_idx>().end())
+        return false;
+    return m_nodes->get<by_idx>().replace(iter, node);
+}
+
+void
+t_stree::remove_node(t_uindex idx) {
+    iter_by_idx iter = m_nodes->get<by_idx>().find(idx);
+    if (iter == m_nodes->get<by_idx>().end())
+        return;
+    m_nodes->get<by_idx>().erase(iter);
+}
+
 bool
 t_stree::has_deltas() const {
     return m_has_delta;
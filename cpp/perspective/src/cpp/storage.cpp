@@ -196,6 +196,7 @@ t_lstore::copy_helper_(const t_lstore& other) {
     m_resize_factor = other.m_resize_factor;
     m_version = other.m_version;
     m_from_recipe = other.m_from_recipe;
+    m_owner.reset();
     PSP_CHECK_CAPACITY();
 }
 
@@ -234,6 +235,9 @@ t_lstore::~t_lstore() {
             }
         } break;
         case BACKING_STORE_MEMORY: {
+            if (m_owner) {
+                // adopted memory is released with `m_owner`
+            } else
 #ifdef _MSC_VER
             if (m_alignment >= 2) {
                 _aligned_free(m_base); // seriously
@@ -330,6 +334,9 @@ t_lstore::reserve_impl(t_uindex capacity, bool allow_shrink) {
     PSP_VERBOSE_ASSERT(capacity >= m_size, "reduce size before reducing capacity!");
     capacity = std::max(capacity, m_size);
 
+    // never realloc memory this store does not own
+    detach();
+
     capacity = 4 * std::uint64_t(ceil(double(capacity * m_resize_factor) / 4));
     capacity = std::max(capacity, static_cast<t_uindex>(8));
     if (m_alignment > 1)
@@ -403,6 +410,7 @@ t_lstore::load(const std::string& fname) {
 
     t_rfmapping imap;
     map_file_read(fname, imap);
+    detach();
     reserve(imap.m_size);
     memcpy(m_base, imap.m_base, size_t(imap.m_size));
     m_size = imap.m_size;
@@ -509,10 +517,52 @@ t_lstore::append(const t_lstore& other) {
     push_back(other.m_base, other.size());
 }
 
+void
+t_lstore::adopt(void* base, t_uindex size, std::shared_ptr<void> owner) {
+    PSP_TRACE_SENTINEL();
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    PSP_VERBOSE_ASSERT(
+        m_backing_store == BACKING_STORE_MEMORY, "Only memory stores can adopt buffers");
+    PSP_VERBOSE_ASSERT(m_alignment < 2, "Cannot adopt buffers into an aligned store");
+    PSP_VERBOSE_ASSERT(owner.get(), "Adopted buffer must have an owner");
+
+    if (!m_owner) {
+        free(m_base);
+    }
+
+    {
+        t_unlock_store tmp(this);
+        m_base = base;
+        m_size = size;
+        m_capacity = size;
+        m_owner = owner;
+        ++m_version;
+    }
+}
+
+void
+t_lstore::detach() {
+    if (!m_owner)
+        return;
+
+    size_t const alloc_size = std::max(size_t(8u), size_t(m_capacity));
+    void* base = calloc(alloc_size, 1);
+    PSP_VERBOSE_ASSERT(base, "MALLOC_FAILED");
+    memcpy(base, m_base, size_t(m_size));
+
+    {
+        t_unlock_store tmp(this);
+        m_base = base;
+        m_capacity = alloc_size;
+        m_owner.reset();
+    }
+}
+
 void
 t_lstore::clear() {
     PSP_TRACE_SENTINEL();
     PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    detach();
 #ifndef PSP_ENABLE_WASM
     memset(m_base, 0, size_t(capacity()));
 #endif
@@ -538,6 +588,7 @@ void
 t_lstore::fill(const t_lstore& other) {
     PSP_TRACE_SENTINEL();
     PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    detach();
     reserve(other.size());
     memcpy(m_base, const_cast<void*>(other.m_base), size_t(other.size()));
     set_size(other.size());
@@ -547,6 +598,7 @@ void
 t_lstore::fill(const t_lstore& other, const t_mask& mask, t_uindex elem_size) {
     PSP_TRACE_SENTINEL();
     PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    detach();
     reserve(mask.size() * elem_size);
 
     PSP_VERBOSE_ASSERT(mask.size() * elem_size <= m_size, "Not enough space to fill");
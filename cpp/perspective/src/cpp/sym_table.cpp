@@ -11,6 +11,7 @@
 #include <perspective/base.h>
 #include <perspective/sym_table.h>
 #include <perspective/column.h>
+#include <perspective/memory_usage.h>
 #include <tsl/hopscotch_map.h>
 #include <functional>
 #include <mutex>
@@ -19,7 +20,8 @@ namespace perspective {
 
 std::mutex sym_table_mutex;
 
-t_symtable::t_symtable() {}
+t_symtable::t_symtable()
+    : m_nbytes(0) {}
 
 t_symtable::~t_symtable() {
     for (auto& kv : m_mapping) {
@@ -37,6 +39,7 @@ t_symtable::get_interned_cstr(const char* s) {
 
     auto scopy = strdup(s);
     m_mapping[scopy] = scopy;
+    m_nbytes += strlen(scopy) + 1;
     return scopy;
 }
 
@@ -69,6 +72,11 @@ t_symtable::size() const {
     return m_mapping.size();
 }
 
+t_uindex
+t_symtable::get_memory_usage() const {
+    return m_nbytes + hash_memory_usage(m_mapping);
+}
+
 static t_symtable*
 get_symtable() {
     static t_symtable* sym = 0;
@@ -86,6 +94,12 @@ get_interned_cstr(const char* s) {
     return sym->get_interned_cstr(s);
 }
 
+t_uindex
+get_interned_memory_usage() {
+    std::lock_guard<std::mutex> guard(sym_table_mutex);
+    return get_symtable()->get_memory_usage();
+}
+
 t_tscalar
 get_interned_tscalar(const char* s) {
     if (t_tscalar::can_store_inplace(s)) {
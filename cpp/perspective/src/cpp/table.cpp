@@ -8,11 +8,20 @@
  */
 
 #include <perspective/table.h>
+#include <perspective/time.h>
 
 // Give each Table a unique ID so that operations on it map back correctly
 static perspective::t_uindex GLOBAL_TABLE_ID = 0;
 
 namespace perspective {
+
+t_shared_context::t_shared_context(
+    const std::string& key, const std::string& name, std::shared_ptr<void> ctx)
+    : m_key(key)
+    , m_name(name)
+    , m_ctx(ctx)
+    , m_refcount(1) {}
+
 Table::Table(
         std::shared_ptr<t_pool> pool,
         const std::vector<std::string>& column_names,
@@ -29,6 +38,10 @@ Table::Table(
     , m_index(index)
     , m_gnode_set(false) {
         validate_columns(m_column_names);
+
+        // Pick up a `TZ` changed since the last table was created, e.g. by
+        // `time.tzset()` in Python.
+        t_local_timezone::refresh();
     }
 
 void
@@ -49,7 +62,26 @@ Table::init(t_data_table& data_table, std::uint32_t row_count, const t_op op, co
     }
 
     PSP_VERBOSE_ASSERT(m_gnode_set, "gnode is not set!");
-    m_pool->send(m_gnode->get_id(), port_id, data_table);
+
+#ifndef PSP_ENABLE_WASM
+    if (m_pool->is_engine_running()) {
+        // `data_table` may not outlive this call, and the engine thread sends
+        // and processes it later, so move its columns into a fragment the
+        // queue owns rather than copy them.
+        auto fragment = std::make_shared<t_data_table>(data_table.get_schema());
+        fragment->init();
+        if (!fragment->swap_columns(data_table)) {
+            fragment = data_table.clone();
+        }
+        m_pool->enqueue(m_gnode->get_id(), port_id, std::move(fragment));
+        m_init = true;
+        return;
+    }
+#endif
+
+    // `data_table` is not read after this call, so let an empty port take
+    // its columns rather than copy them.
+    m_pool->send(m_gnode->get_id(), port_id, std::move(data_table));
 
     m_init = true;
 }
@@ -57,9 +89,19 @@ Table::init(t_data_table& data_table, std::uint32_t row_count, const t_op op, co
 t_uindex
 Table::size() const {
     PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    auto lk = m_pool->lock();
     return m_gnode->get_table()->size();
 }
 
+t_memory_usage
+Table::get_memory_usage() const {
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    t_memory_usage usage;
+    auto lk = m_pool->lock();
+    m_gnode->get_memory_usage(usage);
+    return usage;
+}
+
 t_schema
 Table::get_schema() const {
     PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
@@ -258,6 +300,56 @@ Table::calculate_offset(std::uint32_t row_count) {
     m_offset = (m_offset + row_count) % m_limit;
 }
 
+std::shared_ptr<void>
+Table::_acquire_context(const std::string& key) {
+    std::lock_guard<std::mutex> lk(m_shared_contexts_mtx);
+    auto iter = m_shared_contexts.find(key);
+    if (iter == m_shared_contexts.end()) {
+        return nullptr;
+    }
+
+    iter->second->m_refcount += 1;
+    return iter->second->m_ctx;
+}
+
+void
+Table::share_context(const std::string& key, const std::string& name, std::shared_ptr<void> ctx) {
+    std::lock_guard<std::mutex> lk(m_shared_contexts_mtx);
+    PSP_VERBOSE_ASSERT(m_shared_contexts.find(key) == m_shared_contexts.end(),
+        "Context already shared for key");
+    m_shared_contexts[key] = std::make_shared<t_shared_context>(key, name, ctx);
+}
+
+std::shared_ptr<t_shared_context>
+Table::get_shared_context(const void* ctx) const {
+    std::lock_guard<std::mutex> lk(m_shared_contexts_mtx);
+    for (const auto& kv : m_shared_contexts) {
+        if (kv.second->m_ctx.get() == ctx) {
+            return kv.second;
+        }
+    }
+    return nullptr;
+}
+
+bool
+Table::release_context(std::shared_ptr<t_shared_context> shared) {
+    std::lock_guard<std::mutex> lk(m_shared_contexts_mtx);
+    PSP_VERBOSE_ASSERT(shared->m_refcount > 0, "Context released too many times");
+    shared->m_refcount -= 1;
+    if (shared->m_refcount > 0) {
+        return false;
+    }
+
+    m_shared_contexts.erase(shared->m_key);
+    return true;
+}
+
+t_uindex
+Table::get_share_count(std::shared_ptr<t_shared_context> shared) const {
+    std::lock_guard<std::mutex> lk(m_shared_contexts_mtx);
+    return shared->m_refcount;
+}
+
 t_uindex
 Table::get_id() const {
     return m_id;
@@ -10,6 +10,11 @@
 #include <perspective/first.h>
 #include <perspective/time.h>
 #include <perspective/utils.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
 
 namespace perspective {
 
@@ -240,6 +245,207 @@ operator-(const t_time& a, const t_time& b) {
     return t_tdelta(a.m_storage - b.m_storage);
 }
 
+namespace {
+    // The local timezone is probed once per day, and each change in offset
+    // is then bisected to the second. No timezone database has two
+    // transitions within a single day.
+    const std::int64_t TZ_PROBE_STEP = SECS_PER_DAY;
+
+    void
+    sys_tzset() {
+#ifdef WIN32
+        _tzset();
+#else
+        tzset();
+#endif
+    }
+
+    bool
+    sys_localtime(std::int64_t secs, std::tm& out) {
+        std::time_t t = static_cast<std::time_t>(secs);
+        if (static_cast<std::int64_t>(t) != secs) {
+            return false;
+        }
+#ifdef WIN32
+        return localtime_s(&out, &t) == 0;
+#else
+        return localtime_r(&t, &out) != nullptr;
+#endif
+    }
+
+    bool
+    sys_offset(std::int64_t secs, std::int32_t& offset, std::int32_t& isdst) {
+        std::tm t;
+        if (!sys_localtime(secs, t)) {
+            return false;
+        }
+
+        offset = static_cast<std::int32_t>(
+            to_gmtime(t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min,
+                t.tm_sec)
+            - secs);
+        isdst = t.tm_isdst > 0 ? 1 : 0;
+        return true;
+    }
+} // namespace
+
+t_local_timezone::t_local_timezone(const char* tz)
+    : m_has_tz(tz != nullptr)
+    , m_tz(tz != nullptr ? tz : "")
+    , m_begin(0)
+    , m_end(-1) {
+    // Cover 1970 - 2040, or as much of it as `std::time_t` can represent;
+    // about 26k `localtime_r` probes.
+    std::int64_t begin = to_gmtime(1970, 1, 1, 0, 0, 0);
+    std::int64_t end = to_gmtime(2040, 1, 1, 0, 0, 0);
+    if (sizeof(std::time_t) < sizeof(std::int64_t)) {
+        begin = std::max<std::int64_t>(begin, std::numeric_limits<std::time_t>::min());
+        end = std::min<std::int64_t>(end, std::numeric_limits<std::time_t>::max());
+    }
+
+    t_transition prev;
+    prev.m_utc = begin;
+    if (!sys_offset(begin, prev.m_offset, prev.m_isdst)) {
+        return;
+    }
+
+    m_transitions.push_back(prev);
+    m_begin = begin;
+    m_end = begin;
+
+    while (m_end < end) {
+        std::int64_t probe = std::min(m_end + TZ_PROBE_STEP, end);
+        t_transition next;
+        if (!sys_offset(probe, next.m_offset, next.m_isdst)) {
+            break;
+        }
+
+        if (next.m_offset != prev.m_offset || next.m_isdst != prev.m_isdst) {
+            std::int64_t lo = m_end;
+            std::int64_t hi = probe;
+            while (hi - lo > 1) {
+                std::int64_t mid = lo + (hi - lo) / 2;
+                std::int32_t offset, isdst;
+                sys_offset(mid, offset, isdst);
+                if (offset == prev.m_offset && isdst == prev.m_isdst) {
+                    lo = mid;
+                } else {
+                    hi = mid;
+                    next.m_offset = offset;
+                    next.m_isdst = isdst;
+                }
+            }
+
+            next.m_utc = hi;
+            m_transitions.push_back(next);
+            prev = next;
+        }
+
+        m_end = probe;
+    }
+}
+
+namespace {
+    std::atomic<const t_local_timezone*> current_timezone(nullptr);
+} // namespace
+
+const t_local_timezone&
+t_local_timezone::get() {
+    const t_local_timezone* tbl = current_timezone.load(std::memory_order_acquire);
+    if (tbl == nullptr) {
+        refresh();
+        tbl = current_timezone.load(std::memory_order_acquire);
+    }
+
+    return *tbl;
+}
+
+void
+t_local_timezone::refresh() {
+    static std::mutex mtx;
+
+    // Tables are never freed, as other threads may still be converting with
+    // the table for a previous `TZ`. One is kept per distinct `TZ` seen.
+    static std::vector<std::unique_ptr<t_local_timezone>> tables;
+
+    std::lock_guard<std::mutex> lk(mtx);
+    const char* tz = std::getenv("TZ");
+    const t_local_timezone* tbl = current_timezone.load(std::memory_order_acquire);
+    if (tbl != nullptr && tbl->matches(tz)) {
+        return;
+    }
+
+    // `localtime_r` does not re-read `TZ` by itself.
+    sys_tzset();
+
+    tbl = nullptr;
+    for (const auto& existing : tables) {
+        if (existing->matches(tz)) {
+            tbl = existing.get();
+            break;
+        }
+    }
+
+    if (tbl == nullptr) {
+        tables.emplace_back(new t_local_timezone(tz));
+        tbl = tables.back().get();
+    }
+
+    current_timezone.store(tbl, std::memory_order_release);
+}
+
+bool
+t_local_timezone::matches(const char* tz) const {
+    if (tz == nullptr) {
+        return !m_has_tz;
+    }
+
+    return m_has_tz && m_tz == tz;
+}
+
+const t_local_timezone::t_transition*
+t_local_timezone::find(std::int64_t secs) const {
+    if (secs < m_begin || secs > m_end) {
+        return nullptr;
+    }
+
+    auto iter = std::upper_bound(m_transitions.begin(), m_transitions.end(), secs,
+        [](std::int64_t value, const t_transition& tr) { return value < tr.m_utc; });
+    return &*(iter - 1);
+}
+
+bool
+t_local_timezone::to_tm(std::int64_t secs, std::tm& out) const {
+    const t_transition* tr = find(secs);
+    if (tr == nullptr) {
+        return sys_localtime(secs, out);
+    }
+
+    if (t_time().gmtime(out, secs, tr->m_offset) == 0) {
+        return false;
+    }
+
+    out.tm_isdst = tr->m_isdst;
+    return true;
+}
+
+std::int64_t
+t_local_timezone::get_offset(std::int64_t secs) const {
+    const t_transition* tr = find(secs);
+    if (tr != nullptr) {
+        return tr->m_offset;
+    }
+
+    std::int32_t offset = 0, isdst;
+    sys_offset(secs, offset, isdst);
+    return offset;
+}
+
+bool
+local_tm(std::int64_t secs, std::tm& out) {
+    return t_local_timezone::get().to_tm(secs, out);
+}
+
 } // end namespace perspective
 
 namespace std {
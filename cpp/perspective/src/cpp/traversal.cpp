@@ -12,9 +12,16 @@
 #include <perspective/sparse_tree.h>
 #include <perspective/arg_sort.h>
 #include <perspective/sort_specification.h>
+#include <atomic>
 
 namespace perspective {
 
+namespace {
+    // Versions are drawn from one counter, so that a traversal which
+    // replaces another never reports a version the other has reported.
+    std::atomic<t_uindex> NEXT_TRAVERSAL_VERSION(1);
+} // namespace
+
 t_vdnode::t_vdnode()
     : m_expanded(0)
     , m_depth(INVALID_INDEX) {}
@@ -32,7 +39,8 @@ t_vdnode::t_vdnode(bool expanded, bool has_children)
     , m_has_children(has_children) {}
 
 t_traversal::t_traversal(std::shared_ptr<const t_stree> tree)
-    : m_tree(tree) {
+    : m_tree(tree)
+    , m_version(0) {
     t_stnode_vec rchildren;
     tree->get_child_nodes(0, rchildren);
     populate_root_children(rchildren);
@@ -40,6 +48,7 @@ t_traversal::t_traversal(std::shared_ptr<const t_stree> tree)
 
 void
 t_traversal::populate_root_children(const t_stnode_vec& rchildren) {
+    set_modified();
     m_nodes = std::make_shared<std::vector<t_tvnode>>(rchildren.size() + 1);
 
     // Initialize root
@@ -80,6 +89,8 @@ t_traversal::expand_node(t_index exp_idx) {
         return 0;
     }
 
+    set_modified();
+
     t_stnode_vec tchildren;
     m_tree->get_child_nodes(exp_tvnode.m_tnid, tchildren);
     t_index n_changed = tchildren.size();
@@ -122,6 +133,8 @@ t_traversal::expand_node(const std::vector<t_sortspec>& sortby, t_index exp_idx,
         return 0;
     }
 
+    set_modified();
+
     t_stnode_vec tchildren;
     m_tree->get_child_nodes(exp_tvnode.m_tnid, tchildren);
     t_index n_changed = tchildren.size();
@@ -195,6 +208,8 @@ t_traversal::collapse_node(t_index idx) {
         return 0;
     }
 
+    set_modified();
+
     // Calculate span of descendents
     t_index n_changed = node.m_ndesc;
 
@@ -227,6 +242,7 @@ t_traversal::add_node(const std::vector<t_sortspec>& sortby,
     get_expanded_span(indices, tv_indices, collapsed_ancestor, insert_level_idx);
 
     if (static_cast<t_index>(tv_indices.size()) == insert_level_idx) {
+        set_modified();
         t_index p_tvidx = tv_indices.back();
         const t_tvnode& p_tvnode = (*m_nodes)[p_tvidx];
         t_index p_ptidx = p_tvnode.m_tnid;
@@ -310,6 +326,11 @@ t_traversal::size() const {
     return m_nodes->size();
 }
 
+t_uindex
+t_traversal::get_memory_usage() const {
+    return vector_memory_usage(*m_nodes);
+}
+
 t_depth
 t_traversal::get_depth(t_index idx) const {
     return (*m_nodes)[idx].m_depth;
@@ -328,6 +349,38 @@ t_traversal::get_traversal_index(t_index idx) {
     return rval;
 }
 
+t_index
+t_traversal::get_traversal_index(const std::vector<t_uindex>& ancestry) const {
+    if (ancestry.empty() || m_nodes->empty())
+        return INVALID_INDEX;
+
+    t_index pidx = 0;
+
+    for (t_uindex level = 1, loop_end = ancestry.size(); level < loop_end; ++level) {
+        const t_tvnode& pnode = (*m_nodes)[pidx];
+        if (!pnode.m_expanded)
+            return INVALID_INDEX;
+
+        t_index cidx = pidx + 1;
+        bool found = false;
+        for (t_uindex child = 0; child < pnode.m_nchild; ++child) {
+            const t_tvnode& cnode = (*m_nodes)[cidx];
+            if (static_cast<t_uindex>(cnode.m_tnid) == ancestry[level]) {
+                found = true;
+                break;
+            }
+            cidx += cnode.m_ndesc + 1;
+        }
+
+        if (!found)
+            return INVALID_INDEX;
+
+        pidx = cidx;
+    }
+
+    return pidx;
+}
+
 std::vector<t_vdnode>
 t_traversal::get_view_nodes(t_index bidx, t_index eidx) const {
     std::vector<t_vdnode> vec(eidx - bidx);
@@ -405,6 +458,7 @@ t_traversal::validate_cells(const std::vector<std::pair<t_uindex, t_uindex>>& ce
 
 t_index
 t_traversal::remove_subtree(t_index idx) {
+    set_modified();
     t_tvnode& node = (*m_nodes)[idx];
 
     // Calculate span of descendents
@@ -659,6 +713,16 @@ t_traversal::is_valid_idx(t_index idx) const {
     return idx > 0 && idx < t_index(size());
 }
 
+t_uindex
+t_traversal::get_version() const {
+    return m_version;
+}
+
+void
+t_traversal::set_modified() {
+    m_version = NEXT_TRAVERSAL_VERSION.fetch_add(1);
+}
+
 const t_stree*
 t_traversal::get_tree() const {
     return m_tree.get();
@@ -10,34 +10,72 @@
 #include <perspective/first.h>
 #include <perspective/pool.h>
 #include <perspective/update_task.h>
+#include <perspective/compat.h>
 
 namespace perspective {
 t_update_task::t_update_task(t_pool& pool)
     : m_pool(pool) {}
 
-void
-t_update_task::run() {
-    auto work_to_do = m_pool.m_data_remaining.load();
+t_uindex
+t_update_task::run(std::vector<t_uindex>* updated_ports, bool flush) {
     m_pool.m_data_remaining.store(false);
+    t_uindex next_wait_ms = 0;
+
+    for (auto g : m_pool.m_gnodes) {
+        if (g) {
+            t_uindex num_input_ports = g->num_input_ports();
 
-    if (work_to_do) {
-        for (auto g : m_pool.m_gnodes) {
-            if (g) {
-                t_uindex num_input_ports = g->num_input_ports();
+            // Call process for each port, and notify the updates from
+            // each port individually.
+            for (t_uindex port_id = 0; port_id < num_input_ports; ++port_id) {
+                if (!flush) {
+                    t_uindex wait_ms = g->batch_wait_ms(port_id);
+                    if (wait_ms > 0) {
+                        next_wait_ms = next_wait_ms == 0 ? wait_ms : std::min(next_wait_ms, wait_ms);
+                        continue;
+                    }
+                }
 
-                // Call process for each port, and notify the updates from
-                // each port individually.
-                for (t_uindex port_id = 0; port_id < num_input_ports; ++port_id) {
-                    bool did_notify_context = g->process(port_id);
-                    if (did_notify_context) {
+                bool did_notify_context = g->process(port_id);
+                if (did_notify_context) {
+                    if (updated_ports != nullptr) {
+                        updated_ports->push_back(port_id);
+                    } else {
+                        // Advance the epoch before each callback, so data
+                        // cached per epoch is not reused across ports.
+                        m_pool.inc_epoch();
+                        t_metrics_timer timer(
+                            m_pool.m_metrics.get(), "pool.", "notify_userspace");
                         m_pool.notify_userspace(port_id);
                     }
-                    g->clear_output_ports();
                 }
+                g->clear_output_ports();
             }
         }
     }
 
     m_pool.inc_epoch();
+    record_memory();
+    return next_wait_ms;
+}
+
+void
+t_update_task::record_memory() {
+    t_metrics* metrics = m_pool.m_metrics.get();
+    if (!metrics->is_enabled()) {
+        return;
+    }
+
+    for (auto g : m_pool.m_gnodes) {
+        if (g) {
+            metrics->set_gauge(
+                "gnode." + std::to_string(g->get_id()) + ".mapping_size", g->mapping_size());
+        }
+    }
+
+#ifndef PSP_ENABLE_WASM
+    // `psp_curmem` reads `/proc`, which is not available in WASM.
+    metrics->set_gauge("pool.resident_mb", psp_curmem());
+#endif
 }
 } // end namespace perspective
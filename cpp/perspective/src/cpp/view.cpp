@@ -10,6 +10,7 @@
 #include <perspective/first.h>
 #include <perspective/view.h>
 #include <perspective/arrow_writer.h>
+#include <perspective/memory_usage.h>
 #include <sstream>
 
 
@@ -45,7 +46,9 @@ View<CTX_T>::View(
     , m_ctx(ctx)
     , m_name(name)
     , m_separator(separator)
-    , m_view_config(view_config) {
+    , m_view_config(view_config)
+    , m_row_delta_epoch(0)
+    , m_column_cache_version(0) {
     m_row_pivots = m_view_config->get_row_pivots();
     m_column_pivots = m_view_config->get_column_pivots();
     m_aggregates = m_view_config->get_aggspecs();
@@ -71,6 +74,9 @@ View<CTX_T>::View(
     sides() > 0 ? m_col_offset = 1 : m_col_offset = 0;
 
     // TODO: add index shifting ability
+
+    // Flat contexts are shared between views with the same config.
+    m_shared_context = m_table->get_shared_context(m_ctx.get());
 }
 
 template <typename CTX_T>
@@ -79,7 +85,14 @@ View<CTX_T>::~View() {
     auto gnode = m_table->get_gnode();
     // TODO: need to invalidate memory used by previous computed columns
     // without affecting views that depend on those computed columns.
-    pool->unregister_context(gnode->get_id(), m_name);
+    if (!m_shared_context) {
+        pool->unregister_context(gnode->get_id(), m_name);
+        return;
+    }
+
+    if (m_table->release_context(m_shared_context)) {
+        pool->unregister_context(gnode->get_id(), m_shared_context->m_name);
+    }
 }
 
 template <typename CTX_T>
@@ -115,6 +128,7 @@ View<t_ctx2>::sides() const {
 template <typename CTX_T>
 std::int32_t
 View<CTX_T>::num_rows() const {
+    auto lk = m_table->get_pool()->lock();
     if (is_column_only()) {
         return m_ctx->get_row_count() - 1;
     } else {
@@ -394,6 +408,7 @@ template <>
 std::shared_ptr<t_data_slice<t_ctxunit>>
 View<t_ctxunit>::get_data(
     t_uindex start_row, t_uindex end_row, t_uindex start_col, t_uindex end_col) const {
+    auto lk = m_table->get_pool()->lock();
     std::vector<t_tscalar> slice = m_ctx->get_data(start_row, end_row, start_col, end_col);
     auto col_names = column_names();
     auto data_slice_ptr = std::make_shared<t_data_slice<t_ctxunit>>(m_ctx, start_row, end_row,
@@ -405,6 +420,7 @@ template <>
 std::shared_ptr<t_data_slice<t_ctx0>>
 View<t_ctx0>::get_data(
     t_uindex start_row, t_uindex end_row, t_uindex start_col, t_uindex end_col) const {
+    auto lk = m_table->get_pool()->lock();
     std::vector<t_tscalar> slice = m_ctx->get_data(start_row, end_row, start_col, end_col);
     auto col_names = column_names();
     auto data_slice_ptr = std::make_shared<t_data_slice<t_ctx0>>(m_ctx, start_row, end_row,
@@ -416,6 +432,7 @@ template <>
 std::shared_ptr<t_data_slice<t_ctx1>>
 View<t_ctx1>::get_data(
     t_uindex start_row, t_uindex end_row, t_uindex start_col, t_uindex end_col) const {
+    auto lk = m_table->get_pool()->lock();
     std::vector<t_tscalar> slice = m_ctx->get_data(start_row, end_row, start_col, end_col);
     auto col_names = column_names();
     t_tscalar row_path;
@@ -426,13 +443,54 @@ View<t_ctx1>::get_data(
     return data_slice_ptr;
 }
 
+template <>
+void
+View<t_ctx2>::_update_column_cache() const {
+    if (m_column_cache_names && m_column_cache_version == m_ctx->get_column_version()) {
+        return;
+    }
+
+    std::vector<std::vector<t_tscalar>> cols;
+    m_column_cache_indices.clear();
+
+    if (m_sort.size() > 0) {
+        /**
+         * Perspective generates headers for sorted columns, so we have to
+         * skip them in the underlying context.
+         */
+        auto depth = m_column_pivots.size();
+        auto col_length = m_ctx->unity_get_column_count();
+        m_column_cache_indices.push_back(0);
+        for (t_uindex i = 0; i < col_length; ++i) {
+            if (m_ctx->unity_get_column_path(i + 1).size() == depth) {
+                m_column_cache_indices.push_back(i + 1);
+            }
+        }
+
+        cols = column_names(true, depth);
+    } else {
+        cols = column_names();
+    }
+
+    // TODO: we need to just use column_paths everywhere instead of row path insertion manually,
+    // this causes issues with needing to skip row paths
+    t_tscalar row_path;
+    row_path.set("__ROW_PATH__");
+    cols.insert(cols.begin(), std::vector<t_tscalar>{row_path});
+
+    m_column_cache_names
+        = std::make_shared<const std::vector<std::vector<t_tscalar>>>(std::move(cols));
+    m_column_cache_version = m_ctx->get_column_version();
+}
+
 template <>
 std::shared_ptr<t_data_slice<t_ctx2>>
 View<t_ctx2>::get_data(
     t_uindex start_row, t_uindex end_row, t_uindex start_col, t_uindex end_col) const {
+    auto lk = m_table->get_pool()->lock();
+    _update_column_cache();
     std::vector<t_tscalar> slice;
     std::vector<t_uindex> column_indices;
-    std::vector<std::vector<t_tscalar>> cols;
     bool is_sorted = m_sort.size() > 0;
 
     if (is_column_only()) {
@@ -441,70 +499,24 @@ View<t_ctx2>::get_data(
     }
 
     if (is_sorted) {
-        /**
-         * Perspective generates headers for sorted columns, so we have to
-         * skip them in the underlying slice.
-         */
-        t_uindex start_col_index = start_col;
-        t_uindex end_col_index = end_col;
-
-        // Only construct column_indices if start_col > end_col - get_data will
+        // Only construct column_indices if start_col < end_col - get_data will
         // handle the incorrect data window properly, which is consistent
         // with the implementation for when the context is not sorted.
-        if (start_col < end_col) {
-            auto depth = m_column_pivots.size();
-            auto col_length = m_ctx->unity_get_column_count();
-            column_indices.push_back(0);
-            for (t_uindex i = 0; i < col_length; ++i) {
-                if (m_ctx->unity_get_column_path(i + 1).size() == depth) {
-                    column_indices.push_back(i + 1);
-                }
-            }
-
-            cols = column_names(true, depth);
-
-            // Filter down column indices by user-provided start/end columns
+        t_uindex ncolumns = m_column_cache_indices.size();
+        if (start_col < end_col && start_col < ncolumns) {
             column_indices = std::vector<t_uindex>(
-                column_indices.begin() + start_col,
-                column_indices.begin() + std::min(end_col, (t_uindex)column_indices.size())
-            );
-
-            // If start_col == end_col, then column_indices will be an empty
-            // vector. Only try to access the first and last elements if the
-            // vector is not empty. `get_data` correctly handles cases where
-            // start == end and start > end.
-            if (column_indices.size() > 0) {
-                start_col_index = column_indices.front();
-                end_col_index = column_indices.back() + 1;
-            }
+                m_column_cache_indices.begin() + start_col,
+                m_column_cache_indices.begin() + std::min(end_col, ncolumns));
         }
 
-        std::vector<t_tscalar> slice_with_headers = m_ctx->get_data(
-            start_row, end_row, start_col_index, end_col_index);
-
-        auto iter = slice_with_headers.begin();
-        while (iter != slice_with_headers.end()) {
-            t_uindex prev = column_indices.front();
-            for (auto idx = column_indices.begin(); idx != column_indices.end(); idx++) {
-                t_uindex col_num = *idx;
-                iter += col_num - prev;
-                prev = col_num;
-                slice.push_back(*iter);
-            }
-            if (iter != slice_with_headers.end())
-                iter++;
-        }
+        slice = m_ctx->get_data(start_row, end_row, column_indices);
     } else {
-        cols = column_names();
         slice = m_ctx->get_data(start_row, end_row, start_col, end_col);
     }
-    // TODO: we need to just use column_paths everywhere instead of row path insertion manually,
-    // this causes issues with needing to skip row paths
-    t_tscalar row_path;
-    row_path.set("__ROW_PATH__");
-    cols.insert(cols.begin(), std::vector<t_tscalar>{row_path});
+
     auto data_slice_ptr = std::make_shared<t_data_slice<t_ctx2>>(m_ctx, start_row, end_row,
-        start_col, end_col, m_row_offset, m_col_offset, slice, cols, column_indices);
+        start_col, end_col, m_row_offset, m_col_offset, slice, m_column_cache_names,
+        column_indices);
     return data_slice_ptr;
 }
 
@@ -512,6 +524,14 @@ template <typename CTX_T>
 std::shared_ptr<std::string>
 View<CTX_T>::to_arrow(std::int32_t start_row, std::int32_t end_row,
     std::int32_t start_col, std::int32_t end_col) const {
+    t_metrics* metrics = m_table->get_pool()->get_metrics().get();
+    std::string prefix;
+    if (metrics != nullptr && metrics->is_enabled()) {
+        prefix = "view." + m_name + ".";
+    }
+
+    t_metrics_timer timer(metrics, prefix, "to_arrow");
+    auto lk = m_table->get_pool()->lock();
     std::shared_ptr<t_data_slice<CTX_T>> data_slice = get_data(
         start_row, end_row, start_col, end_col
     );
@@ -689,6 +709,7 @@ View<CTX_T>::_set_deltas_enabled(bool enabled_state) {
 template <typename CTX_T>
 bool
 View<CTX_T>::get_row_expanded(std::int32_t ridx) const {
+    auto lk = m_table->get_pool()->lock();
     return m_ctx->unity_get_row_expanded(ridx);
 }
 
@@ -707,14 +728,20 @@ View<t_ctx0>::expand(std::int32_t ridx, std::int32_t row_pivot_length) {
 template <>
 t_index
 View<t_ctx1>::expand(std::int32_t ridx, std::int32_t row_pivot_length) {
-    return m_ctx->open(ridx);
+    auto lk = m_table->get_pool()->lock();
+    t_index retval = m_ctx->open(ridx);
+    m_row_delta = nullptr;
+    return retval;
 }
 
 template <>
 t_index
 View<t_ctx2>::expand(std::int32_t ridx, std::int32_t row_pivot_length) {
+    auto lk = m_table->get_pool()->lock();
     if (m_ctx->unity_get_row_depth(ridx) < t_uindex(row_pivot_length)) {
-        return m_ctx->open(t_header::HEADER_ROW, ridx);
+        t_index retval = m_ctx->open(t_header::HEADER_ROW, ridx);
+        m_row_delta = nullptr;
+        return retval;
     } else {
         return ridx;
     }
@@ -735,13 +762,19 @@ View<t_ctx0>::collapse(std::int32_t ridx) {
 template <>
 t_index
 View<t_ctx1>::collapse(std::int32_t ridx) {
-    return m_ctx->close(ridx);
+    auto lk = m_table->get_pool()->lock();
+    t_index retval = m_ctx->close(ridx);
+    m_row_delta = nullptr;
+    return retval;
 }
 
 template <>
 t_index
 View<t_ctx2>::collapse(std::int32_t ridx) {
-    return m_ctx->close(t_header::HEADER_ROW, ridx);
+    auto lk = m_table->get_pool()->lock();
+    t_index retval = m_ctx->close(t_header::HEADER_ROW, ridx);
+    m_row_delta = nullptr;
+    return retval;
 }
 
 template <>
@@ -756,7 +789,9 @@ template <>
 void
 View<t_ctx1>::set_depth(std::int32_t depth, std::int32_t row_pivot_length) {
     if (row_pivot_length >= depth) {
+        auto lk = m_table->get_pool()->lock();
         m_ctx->set_depth(depth);
+        m_row_delta = nullptr;
     } else {
         std::cout << "Cannot expand past " << std::to_string(row_pivot_length) << std::endl;
     }
@@ -766,13 +801,46 @@ template <>
 void
 View<t_ctx2>::set_depth(std::int32_t depth, std::int32_t row_pivot_length) {
     if (row_pivot_length >= depth) {
+        auto lk = m_table->get_pool()->lock();
         m_ctx->set_depth(t_header::HEADER_ROW, depth);
+        m_row_delta = nullptr;
     } else {
         std::cout << "Cannot expand past " << std::to_string(row_pivot_length) << std::endl;
     }
 }
 
 // Getters
+template <typename CTX_T>
+t_memory_usage
+View<CTX_T>::get_memory_usage() const {
+    t_memory_usage usage;
+    auto lk = m_table->get_pool()->lock();
+    m_ctx->get_memory_usage(usage);
+
+    if (m_shared_context) {
+        t_uindex share_count = m_table->get_share_count(m_shared_context);
+        if (share_count > 1) {
+            for (auto& kv : usage) {
+                kv.second /= share_count;
+            }
+        }
+    }
+
+    if (m_row_delta) {
+        usage["serialization"] += m_row_delta->capacity();
+    }
+
+    if (m_column_cache_names) {
+        usage["serialization"] += vector_memory_usage(*m_column_cache_names)
+            + vector_memory_usage(m_column_cache_indices);
+        for (const auto& path : *m_column_cache_names) {
+            usage["serialization"] += vector_memory_usage(path);
+        }
+    }
+
+    return usage;
+}
+
 template <typename CTX_T>
 std::shared_ptr<CTX_T>
 View<CTX_T>::get_context() const {
@@ -836,6 +904,7 @@ View<CTX_T>::get_row_path(t_uindex idx) const {
 template <typename CTX_T>
 t_stepdelta
 View<CTX_T>::get_step_delta(t_index bidx, t_index eidx) const {
+    auto lk = m_table->get_pool()->lock();
     return m_ctx->get_step_delta(bidx, eidx);
 }
 
@@ -848,6 +917,7 @@ View<t_ctxunit>::get_step_delta(t_index bidx, t_index eidx) const {
 template <typename CTX_T>
 std::shared_ptr<t_data_slice<CTX_T>>
 View<CTX_T>::get_row_delta() const {
+    auto lk = m_table->get_pool()->lock();
     t_rowdelta delta = m_ctx->get_row_delta();
     const std::vector<t_tscalar>& data = delta.data;
     t_uindex num_rows_changed = delta.num_rows_changed;
@@ -869,6 +939,30 @@ View<CTX_T>::get_row_delta() const {
         m_row_offset, m_col_offset, data, paths);
 }
 
+template <typename CTX_T>
+std::shared_ptr<std::string>
+View<CTX_T>::get_row_delta_arrow() const {
+    auto lk = m_table->get_pool()->lock();
+    t_uindex epoch = m_table->get_pool()->epoch();
+
+    if (m_row_delta && m_row_delta_epoch == epoch) {
+        return m_row_delta;
+    }
+
+    t_metrics* metrics = m_table->get_pool()->get_metrics().get();
+    std::string prefix;
+    if (metrics != nullptr && metrics->is_enabled()) {
+        prefix = "view." + m_name + ".";
+    }
+
+    {
+        t_metrics_timer timer(metrics, prefix, "row_delta");
+        m_row_delta = data_slice_to_arrow(get_row_delta());
+    }
+    m_row_delta_epoch = epoch;
+    return m_row_delta;
+}
+
 template <typename CTX_T>
 t_dtype
 View<CTX_T>::get_column_dtype(t_uindex idx) const {
@@ -8,6 +8,8 @@
  */
 
 #include <perspective/view_config.h>
+#include <cstring>
+#include <sstream>
 
 namespace perspective {
 
@@ -196,6 +198,88 @@ t_view_config::get_column_pivot_depth() const {
     return m_column_pivot_depth;
 }
 
+std::string
+t_view_config::get_context_key() const {
+    PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+    std::stringstream ss;
+
+    // Length-prefix every string so that no combination of names can
+    // produce the same key as a different config.
+    auto write_str = [&ss](const std::string& str) { ss << str.size() << ":" << str; };
+    auto write_strs = [&ss, &write_str](const std::vector<std::string>& strs) {
+        ss << "[" << strs.size();
+        for (const auto& str : strs) {
+            write_str(str);
+        }
+        ss << "]";
+    };
+
+    // Write scalars exactly, as `to_string()` rounds floats and formats
+    // datetimes in local time.
+    auto write_scalar = [&ss, &write_str](const t_tscalar& value) {
+        ss << static_cast<std::uint32_t>(value.get_dtype()) << ","
+           << static_cast<std::uint32_t>(value.m_status) << ",";
+        switch (value.get_dtype()) {
+            case DTYPE_STR: {
+                write_str(value.to_string());
+            } break;
+            case DTYPE_FLOAT64: {
+                std::uint64_t bits;
+                std::memcpy(&bits, &value.m_data.m_float64, sizeof(bits));
+                ss << bits << ",";
+            } break;
+            case DTYPE_FLOAT32: {
+                std::uint32_t bits;
+                std::memcpy(&bits, &value.m_data.m_float32, sizeof(bits));
+                ss << bits << ",";
+            } break;
+            default: { ss << value.to_int64() << ","; } break;
+        }
+    };
+
+    write_strs(m_row_pivots);
+    write_strs(m_column_pivots);
+    write_strs(m_columns);
+
+    ss << "[" << m_aggregates.size();
+    for (const auto& agg : m_aggregates) {
+        write_str(agg.first);
+        write_strs(agg.second);
+    }
+    ss << "]";
+
+    ss << "[" << m_filter.size();
+    for (const auto& term : m_filter) {
+        write_str(std::get<0>(term));
+        write_str(std::get<1>(term));
+        const auto& values = std::get<2>(term);
+        ss << "[" << values.size();
+        for (const auto& value : values) {
+            write_scalar(value);
+        }
+        ss << "]";
+    }
+    ss << "]";
+
+    ss << "[" << m_sort.size();
+    for (const auto& sort : m_sort) {
+        write_strs(sort);
+    }
+    ss << "]";
+
+    ss << "[" << m_computed_columns.size();
+    for (const auto& computed : m_computed_columns) {
+        write_str(std::get<0>(computed));
+        ss << static_cast<std::uint32_t>(std::get<1>(computed)) << ",";
+        write_strs(std::get<2>(computed));
+    }
+    ss << "]";
+
+    write_str(m_filter_op);
+    ss << m_column_only;
+    return ss.str();
+}
+
 // PRIVATE
 void
 t_view_config::fill_aggspecs(std::shared_ptr<t_schema> schema) {
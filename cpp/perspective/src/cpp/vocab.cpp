@@ -50,6 +50,7 @@ t_vocab::reserve(size_t total_string_size, size_t string_count) {
     m_vlendata->reserve(total_string_size);
     m_extents->reserve(sizeof(std::pair<t_uindex, t_uindex>) * string_count);
     rebuild_map();
+    m_map.reserve(string_count);
 }
 
 bool
@@ -153,6 +154,7 @@ t_vocab::nbytes() const {
     t_uindex rv = 0;
     rv += m_vlendata->capacity();
     rv += m_extents->capacity();
+    rv += hash_memory_usage(m_map);
     return rv;
 }
 
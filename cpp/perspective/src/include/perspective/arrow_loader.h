@@ -69,6 +69,17 @@ namespace apachearrow {
             std::uint32_t limit, 
             bool is_update);
 
+        /**
+         * @brief Fill fixed-width columns by adopting the Arrow buffers
+         * instead of copying them. `owner` must own the binary passed to
+         * `initialize`; it is shared with every column that adopts memory
+         * from the binary, which is released only once the last of them
+         * has been copied or destroyed.
+         *
+         * @param owner
+         */
+        void set_zero_copy(std::shared_ptr<void> owner);
+
         std::vector<std::string> names() const;
         std::vector<t_dtype> types() const;
         std::uint32_t row_count() const;
@@ -86,6 +97,7 @@ namespace apachearrow {
         std::shared_ptr<arrow::Table> m_table;
         std::vector<std::string> m_names;
         std::vector<t_dtype> m_types;
+        std::shared_ptr<void> m_owner;
     };
 
     template <typename T, typename V>
@@ -103,5 +115,66 @@ namespace apachearrow {
         const int64_t offset,
         const int64_t len);
 
+    /**
+     * @brief Reserve room in the vocab of `dest` for every string of
+     * `dictionaries`, so that interning them does not grow it repeatedly.
+     *
+     * @param dest
+     * @param dictionaries
+     */
+    void
+    reserve_dictionaries(
+        std::shared_ptr<t_column> dest,
+        const std::vector<std::shared_ptr<arrow::Array>>& dictionaries);
+
+    /**
+     * @brief Intern every string of `dictionary`, the values of a
+     * dictionary array, into the vocab of `dest`, returning the vocab id for
+     * each dictionary position. Call `reserve_dictionaries` first, so the vocab is not
+     * grown one string at a time.
+     *
+     * @param dest
+     * @param dictionary
+     * @return std::vector<t_uindex>
+     */
+    std::vector<t_uindex>
+    intern_dictionary(
+        std::shared_ptr<t_column> dest,
+        std::shared_ptr<arrow::Array> dictionary);
+
+    /**
+     * @brief Write the indices of a dictionary array into `dest`, mapped to
+     * vocab ids through `vocab_ids`.
+     *
+     * @param dest
+     * @param src
+     * @param vocab_ids
+     * @param offset
+     * @param len
+     */
+    void
+    copy_dictionary_indices(
+        std::shared_ptr<t_column> dest,
+        std::shared_ptr<arrow::Array> src,
+        const std::vector<t_uindex>& vocab_ids,
+        const int64_t offset,
+        const int64_t len);
+
+    /**
+     * @brief Point `dest` at the values buffer of `src` without copying,
+     * returning false if the array's memory layout does not match the
+     * column's. `owner` owns the binary `src` was read from.
+     *
+     * @param dest
+     * @param src
+     * @param owner
+     * @return bool
+     */
+    bool
+    adopt_array(
+        std::shared_ptr<t_column> dest,
+        std::shared_ptr<arrow::Array> src,
+        std::shared_ptr<void> owner);
+
 } // namespace arrow
 } // namespace perspective
\ No newline at end of file
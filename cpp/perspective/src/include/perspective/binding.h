@@ -227,6 +227,9 @@ namespace binding {
      * @param index
      * @param is_update
      * @param is_arrow
+     * @param is_csv
+     * @param is_json - `accessor` is a JSON or NDJSON string, which is
+     * parsed natively by `json::JsonLoader`.
      * @return std::shared_ptr<t_gnode>
      */
     template <typename T>
@@ -239,6 +242,7 @@ namespace binding {
         bool is_update,
         bool is_arrow,
         bool is_csv,
+        bool is_json,
         t_uindex port_id);
 
     /******************************************************************************
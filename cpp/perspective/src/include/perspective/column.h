@@ -116,6 +116,16 @@ public:
 
     void reserve(t_uindex idx);
 
+    // Release capacity beyond `size` elements, or beyond the column's size
+    // if that is larger.
+    void shrink(t_uindex size);
+
+    // Use `size` elements of externally owned memory as the data store of
+    // this fixed width column without copying them. `owner` must own the
+    // memory; the column holds a reference to it for as long as it points
+    // into the memory.
+    void adopt_data(const void* base, t_uindex size, std::shared_ptr<void> owner);
+
     //object storage
     template <typename T>
     void object_copied(std::uint64_t ptr) const;
@@ -129,6 +139,13 @@ public:
 
     t_uindex size() const;
 
+    /**
+     * @brief Bytes allocated for this column's data, status and vocabulary.
+     *
+     * @return t_uindex
+     */
+    t_uindex get_memory_usage() const;
+
     t_uindex get_vlenidx() const;
 
     const char* unintern_c(t_uindex idx) const;
@@ -201,6 +218,9 @@ public:
 
     t_uindex get_interned(const std::string& s);
     t_uindex get_interned(const char* s);
+
+    // Look up `s` in the vocabulary without interning it
+    bool string_exists(const char* s, t_uindex& interned) const;
     void _rebuild_map();
 
     void borrow_vocabulary(const t_column& o);
@@ -47,8 +47,13 @@ std::string cwd();
 
 PERSPECTIVE_EXPORT std::int64_t get_page_size();
 PERSPECTIVE_EXPORT std::int64_t psp_curtime();
+
+// Resident memory of the process, in MB
 PERSPECTIVE_EXPORT std::int64_t psp_curmem();
 
+// The operating system's id for the calling thread
+PERSPECTIVE_EXPORT std::uint64_t psp_thread_id();
+
 PERSPECTIVE_EXPORT void* psp_dbg_malloc(size_t size);
 PERSPECTIVE_EXPORT void psp_dbg_free(void* mem);
 
@@ -69,6 +69,9 @@ void enable();
 
 std::vector<t_stree*> get_trees();
 
+// Add the bytes held by this context to `usage`, by category
+void get_memory_usage(t_memory_usage& usage) const;
+
 bool has_deltas() const;
 
 void pprint() const;
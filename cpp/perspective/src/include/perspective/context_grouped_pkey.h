@@ -16,6 +16,8 @@
 #include <perspective/data_table.h>
 #include <perspective/path.h>
 #include <perspective/sym_table.h>
+#include <tsl/hopscotch_map.h>
+#include <tsl/hopscotch_set.h>
 
 namespace perspective {
 
@@ -55,6 +57,36 @@ public:
 private:
     void rebuild();
 
+    /**
+     * @brief Apply an inserted or updated row to the tree and traversal, in
+     * work proportional to the row's node, its ancestors and any subtree it
+     * moves.
+     *
+     * @return bool - false if the row changes the tree in a way that cannot
+     * be applied incrementally, i.e. a changed or duplicated child key, or a
+     * cycle of parents, in which case the caller should `rebuild()`.
+     */
+    bool update_row(const t_tscalar& pkey, const t_tscalar& child, const t_tscalar& parent,
+        const t_tscalar& sort_value);
+    void remove_row(const t_tscalar& pkey, t_uindex nidx);
+
+    // Move `nidx` and its descendents under `pidx`, updating the traversal
+    bool move_node(t_uindex nidx, t_uindex pidx, const t_tscalar& sort_value);
+    void add_to_traversal(t_uindex nidx);
+    void remove_from_traversal(t_uindex nidx);
+    void set_orphan(t_uindex nidx, const t_tscalar& parent, bool orphan);
+    t_uindex resolve_parent(const t_tscalar& child, const t_tscalar& parent) const;
+    t_uindex gen_nidx();
+
+    /**
+     * @brief Check that the tree built by the incremental path matches a
+     * full `rebuild()` of the same table, node for node: child and parent
+     * keys, depth, sort value and identity aggregates. The context is left
+     * rebuilt. Called on every incremental step when built with
+     * `PSP_GNODE_VERIFY`.
+     */
+    void verify_incremental();
+
     std::shared_ptr<t_traversal> m_traversal;
     std::shared_ptr<t_stree> m_tree;
     std::vector<t_sortspec> m_sortby;
@@ -62,6 +94,25 @@ private:
     bool m_has_label;
     t_depth m_depth;
     bool m_depth_set;
+
+    // Maps each row of the (filtered) pkeyed table to its tree node, so
+    // updates can be applied without a rebuild. `m_incremental` is false
+    // when the last rebuild could not place every row, i.e. on duplicate
+    // child keys or cycles, and `notify` then always rebuilds.
+    bool m_incremental;
+
+    // Whether `notify` rebuilt the tree, or applied any rows incrementally,
+    // during the current step.
+    bool m_rebuilt;
+    bool m_rows_updated;
+    tsl::hopscotch_map<t_tscalar, t_uindex> m_pkey_nidx;
+    tsl::hopscotch_map<t_tscalar, t_uindex> m_child_nidx;
+    tsl::hopscotch_map<t_uindex, t_tscalar> m_nidx_parent;
+
+    // Root children whose parent key is not (yet) in the tree, by that key
+    tsl::hopscotch_map<t_tscalar, tsl::hopscotch_set<t_uindex>> m_orphans;
+    std::vector<t_uindex> m_free_nidx;
+    t_uindex m_next_nidx;
 };
 
 typedef std::shared_ptr<t_ctx_grouped_pkey> t_ctx_grouped_pkey_sptr;
@@ -34,6 +34,14 @@ public:
 
     t_totals get_totals() const;
     std::vector<t_index> get_ctraversal_indices() const;
+
+    /**
+     * @brief A version of the column axis, which changes whenever columns
+     * are added, removed, reordered, expanded or collapsed.
+     *
+     * @return t_uindex
+     */
+    t_uindex get_column_version() const;
     t_uindex get_num_view_columns() const;
 
     std::vector<t_tscalar> get_row_path(t_index idx) const;
@@ -50,6 +58,19 @@ public:
 
     void set_depth(t_header header, t_depth depth);
 
+    /**
+     * @brief The data of rows `[start_row, end_row)` in the listed context
+     * columns only, in the order given, so that a viewport need not compute
+     * the columns between its own, e.g. the headers of a column-sorted view.
+     *
+     * @param start_row
+     * @param end_row
+     * @param columns
+     * @return std::vector<t_tscalar> of `nrows * columns.size()` scalars
+     */
+    std::vector<t_tscalar> get_data(
+        t_index start_row, t_index end_row, const std::vector<t_uindex>& columns) const;
+
     using t_ctxbase<t_ctx2>::get_data;
 
 protected:
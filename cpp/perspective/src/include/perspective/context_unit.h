@@ -126,6 +126,14 @@ public:
     bool unity_get_row_expanded(t_uindex idx) const;
     bool unity_get_column_expanded(t_uindex idx) const;
 
+    /**
+     * @brief Add the bytes held by this context to `usage`. The unit context
+     * reads directly from the master table, so only its deltas are counted.
+     *
+     * @param usage
+     */
+    void get_memory_usage(t_memory_usage& usage) const;
+
 protected:
     void add_delta_pkey(t_tscalar pkey);
     
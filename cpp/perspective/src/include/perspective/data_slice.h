@@ -72,6 +72,22 @@ public:
         const std::vector<std::vector<t_tscalar>>& column_names,
         const std::vector<t_uindex>& column_indices);
 
+    /**
+     * @brief Construct a new data slice which shares `column_names` rather
+     * than copying them, i.e. with the cached headers of a view.
+     */
+    t_data_slice(
+        std::shared_ptr<CTX_T> ctx,
+        t_uindex start_row,
+        t_uindex end_row,
+        t_uindex start_col,
+        t_uindex end_col,
+        t_uindex row_offset,
+        t_uindex col_offset,
+        const std::vector<t_tscalar>& slice,
+        std::shared_ptr<const std::vector<std::vector<t_tscalar>>> column_names,
+        const std::vector<t_uindex>& column_indices);
+
     ~t_data_slice();
 
     /**
@@ -131,7 +147,7 @@ private:
     t_uindex m_col_offset;
     t_uindex m_stride;
     std::vector<t_tscalar> m_slice;
-    std::vector<std::vector<t_tscalar>> m_column_names;
+    std::shared_ptr<const std::vector<std::vector<t_tscalar>>> m_column_names;
     std::vector<t_uindex> m_column_indices;
 };
 } // end namespace perspective
\ No newline at end of file
@@ -80,6 +80,13 @@ public:
 
     t_uindex size() const;
     t_uindex get_capacity() const;
+
+    /**
+     * @brief Bytes allocated for all columns of this table.
+     *
+     * @return t_uindex
+     */
+    t_uindex get_memory_usage() const;
     t_dtype get_dtype(const std::string& colname) const;
 
     std::shared_ptr<t_column> get_column(const std::string& colname);
@@ -101,6 +108,10 @@ public:
     // Only increment capacity
     void reserve(t_uindex nelems);
 
+    // Release capacity beyond `nelems` rows, or beyond the table's size if
+    // that is larger.
+    void shrink(t_uindex nelems);
+
     // Increment capacity and size
     void extend(t_uindex nelems);
 
@@ -120,6 +131,16 @@ public:
 
     void append(const t_data_table& other);
 
+    /**
+     * @brief Exchange columns, size and capacity with `other`, matching
+     * columns by name. Returns false and leaves both tables untouched unless
+     * they have the same columns with the same dtypes and status settings.
+     *
+     * @param other
+     * @return bool
+     */
+    bool swap_columns(t_data_table& other);
+
     void clear();
     void reset();
 
@@ -16,13 +16,86 @@
 
 namespace perspective {
 
+/**
+ * @brief The calendar fields of a parsed date or datetime string.
+ */
+struct PERSPECTIVE_EXPORT t_parsed_datetime {
+    t_parsed_datetime();
+
+    /**
+     * @brief Milliseconds since the epoch, in UTC. Datetimes without a
+     * timezone designator are read as UTC.
+     *
+     * @return std::int64_t
+     */
+    std::int64_t to_epoch_ms() const;
+
+    /**
+     * @brief Milliseconds since the epoch, in UTC, reading datetimes without
+     * a timezone designator in local time as `std::mktime` does. Returns
+     * false if the local time cannot be represented.
+     *
+     * @param out
+     * @return bool
+     */
+    bool to_local_epoch_ms(std::int64_t& out) const;
+
+    std::int32_t m_year;
+
+    // 1 - 12
+    std::int32_t m_month;
+    std::int32_t m_day;
+    std::int32_t m_hour;
+    std::int32_t m_minute;
+    std::int32_t m_second;
+    std::int32_t m_millisecond;
+
+    // Offset from UTC of the timezone designator, in minutes
+    std::int32_t m_tz_offset;
+    bool m_has_time;
+
+    // Whether the string carried a timezone designator at all, as opposed to
+    // a naive datetime which `to_epoch_ms` reads as UTC and
+    // `to_local_epoch_ms` in local time.
+    bool m_has_tz_offset;
+};
+
 class PERSPECTIVE_EXPORT t_date_parser {
 public:
     t_date_parser();
 
     bool is_valid(std::string const& datestring);
 
+    /**
+     * @brief Parse an ISO-8601 date (`YYYY-MM-DD`) or datetime
+     * (`YYYY-MM-DD[T ]HH:MM[:SS[.fff]][Z|+HH:MM]`) without going through
+     * `std::get_time`, returning false if `str` is in any other format.
+     *
+     * @param str
+     * @param len
+     * @param out
+     * @return bool
+     */
+    bool parse(const char* str, t_uindex len, t_parsed_datetime& out) const;
+
+    /**
+     * @brief Parse any format accepted by `parse`, as well as the
+     * `YYYY/MM/DD` family (`YYYY[/.-]M[/.-]D`), the month-first
+     * `M[/.-]D[/.-]YYYY` family, and RFC-2822 dates
+     * (`[Www, ]D Mon YYYY`). Each may be followed by a time
+     * (`HH:MM[:SS[.fff]]`) and a timezone designator, which is either an
+     * offset, `Z`, `UT`, `UTC` or `GMT`. Returns false for anything else,
+     * including out of range fields, so that callers can fall back to a more
+     * lenient parser.
+     *
+     * @param str
+     * @param len
+     * @param out
+     * @return bool
+     */
+    bool parse_extended(const char* str, t_uindex len, t_parsed_datetime& out) const;
+
 private:
     static const std::string VALID_FORMATS[12];
 };
-} // end namespace perspective
\ No newline at end of file
+} // end namespace perspective
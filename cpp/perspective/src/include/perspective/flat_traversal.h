@@ -56,6 +56,14 @@ public:
 
     t_index size() const;
 
+    /**
+     * @brief Bytes held by the sorted index of this traversal, including
+     * the sort values of each row, and its primary key lookups.
+     *
+     * @return t_uindex
+     */
+    t_uindex get_memory_usage() const;
+
     void get_row_indices(const tsl::hopscotch_set<t_tscalar>& pkeys,
         tsl::hopscotch_map<t_tscalar, t_index>& out_map) const;
 
@@ -24,7 +24,9 @@
 #include <perspective/computed.h>
 #include <perspective/computed_column_map.h>
 #include <perspective/computed_function.h>
+#include <perspective/metrics.h>
 #include <tsl/ordered_map.h>
+#include <set>
 #ifdef PSP_ENABLE_PYTHON
 #include <thread>
 #endif
@@ -71,6 +73,55 @@ struct PERSPECTIVE_EXPORT t_process_table_result {
     std::shared_ptr<t_data_table> m_flattened_data_table;
     bool m_should_notify_userspace;
 };
+
+/**
+ * @brief Controls how long updates accumulate on an input port before the
+ * pool's engine thread processes them. A pending batch is processed once it
+ * holds `m_max_rows` rows or an estimated `m_max_bytes` bytes, and never
+ * later than `m_max_latency_ms` after its first fragment arrived. Zero
+ * limits are ignored, and with a `m_max_latency_ms` of 0 (the default)
+ * every batch is processed as soon as possible. Without the engine thread,
+ * `t_pool::_process` processes every batch at once.
+ */
+struct PERSPECTIVE_EXPORT t_batch_policy {
+    t_batch_policy();
+
+    t_uindex m_max_latency_ms;
+    t_uindex m_max_rows;
+    t_uindex m_max_bytes;
+};
+
+/**
+ * @brief The sizes of the batches processed by a `t_gnode`, and how long
+ * each waited between its first fragment arriving and being processed.
+ */
+struct PERSPECTIVE_EXPORT t_batch_stats {
+    t_batch_stats();
+
+    t_uindex m_num_batches;
+    t_uindex m_num_rows;
+    t_uindex m_last_rows;
+    t_uindex m_max_rows;
+    double m_last_latency_ms;
+    double m_max_latency_ms;
+};
+
+/**
+ * @brief Controls when a `t_gnode` releases the capacity its input port and
+ * transitional tables kept from a past spike. After `m_min_updates`
+ * consecutive updates whose row count (or `m_min_rows`, if larger) is under
+ * `1 / m_ratio` of the tables' capacity, they are shrunk to the largest of
+ * those updates. With `m_shrink_master`, the master table's slack beyond
+ * that is released as well. An `m_min_updates` of 0 disables shrinking.
+ */
+struct PERSPECTIVE_EXPORT t_shrink_policy {
+    t_shrink_policy();
+
+    t_uindex m_min_updates;
+    double m_ratio;
+    t_uindex m_min_rows;
+    bool m_shrink_master;
+};
 class PERSPECTIVE_EXPORT t_gnode {
 public:
     /**
@@ -106,6 +157,15 @@ public:
      */
     void send(t_uindex port_id, const t_data_table& fragments);
 
+    /**
+     * @brief Send a t_data_table that the caller no longer needs. If the
+     * port is empty, its columns are swapped in rather than copied.
+     *
+     * @param port_id
+     * @param fragments
+     */
+    void send(t_uindex port_id, t_data_table&& fragments);
+
     /**
      * @brief Given a port_id, call `process_table` on the port's data table,
      * reconciling all queued calls to `update` and `remove` on that port.
@@ -159,7 +219,16 @@ public:
     void release_outputs();
 
     std::vector<std::string> get_registered_contexts() const;
+
+    /**
+     * @brief The names of the contexts that had deltas after being notified,
+     * in name order, since `clear_contexts_last_updated` was last called.
+     *
+     * @return std::vector<std::string>
+     */
     std::vector<std::string> get_contexts_last_updated() const;
+    bool has_contexts_last_updated() const;
+    void clear_contexts_last_updated();
 
     void clear_input_ports();
     void clear_output_ports();
@@ -177,11 +246,46 @@ public:
     std::vector<t_custom_column> get_custom_columns() const;
 
     void set_pool_cleanup(std::function<void()> cleanup);
+
+    /**
+     * @brief Record the duration of each processing stage, and of each
+     * context's `notify` and `step_end`, in `metrics` as
+     * `gnode.<id>.<stage>`.
+     *
+     * @param metrics
+     */
+    void set_metrics(std::shared_ptr<t_metrics> metrics);
     bool was_updated() const;
     void clear_updated();
 
     t_uindex mapping_size() const;
 
+    /**
+     * @brief Add the bytes held by this gnode to `usage`, as `master_table`,
+     * `mapping`, `input_ports` and `transitional_tables`. Contexts are not
+     * included, and are reported separately by each view.
+     *
+     * @param usage
+     */
+    void get_memory_usage(t_memory_usage& usage) const;
+
+    void set_batch_policy(const t_batch_policy& policy);
+    const t_batch_policy& get_batch_policy() const;
+    const t_batch_stats& get_batch_stats() const;
+
+    void set_shrink_policy(const t_shrink_policy& policy);
+    const t_shrink_policy& get_shrink_policy() const;
+
+    /**
+     * @brief Return the number of milliseconds until the batch pending on
+     * `port_id` is due under the gnode's `t_batch_policy`, or 0 if it should
+     * be processed now.
+     * 
+     * @param port_id 
+     * @return t_uindex 
+     */
+    t_uindex batch_wait_ms(t_uindex port_id) const;
+
     // helper function for JS interface
     void promote_column(const std::string& name, t_dtype new_type);
 
@@ -237,8 +341,12 @@ protected:
     bool have_context(const std::string& name) const;
     void notify_contexts(const t_data_table& flattened);
 
+    /**
+     * @brief Notify a single context of the update in `flattened`, returning
+     * whether the context has deltas afterwards.
+     */
     template <typename CTX_T>
-    void notify_context(const t_data_table& flattened, const t_ctx_handle& ctxh);
+    bool notify_context(const t_data_table& flattened, const t_ctx_handle& ctxh);
 
     template <typename CTX_T>
     void notify_context(CTX_T* ctx, const t_data_table& flattened, const t_data_table& delta,
@@ -359,6 +467,26 @@ protected:
         const std::vector<t_rlookup>& changed_rows);
 
 private:
+    /**
+     * @brief Return the input port `port_id` for either `send` overload to
+     * write to, recording when it starts holding pending rows, or nullptr
+     * if it does not exist.
+     *
+     * @param port_id
+     * @return std::shared_ptr<t_port>
+     */
+    std::shared_ptr<t_port> _get_send_port(t_uindex port_id);
+
+    /**
+     * @brief Count an update of `num_rows` rows against the gnode's
+     * `t_shrink_policy`, and shrink the input port, transitional and
+     * (optionally) master tables once the policy's threshold is reached.
+     * Must be called while the transitional tables are empty.
+     *
+     * @param num_rows
+     */
+    void _shrink_tables(t_uindex num_rows);
+
     /**
      * @brief Process the input data table by flattening it, calculating
      * transitional values, and returning a new masked version.
@@ -394,12 +522,34 @@ private:
     // `t_gnode_port` enum.
     std::vector<std::shared_ptr<t_port>> m_oports;
     std::map<std::string, t_ctx_handle> m_contexts;
+
+    // Contexts that had deltas after `notify_contexts`, which accumulate
+    // until they are published by `t_pool::get_contexts_last_updated`.
+    std::set<std::string> m_contexts_last_updated;
     std::shared_ptr<t_gstate> m_gstate;
     std::chrono::high_resolution_clock::time_point m_epoch;
     std::vector<t_custom_column> m_custom_columns;
     std::function<void()> m_pool_cleanup;
     bool m_was_updated;
 
+    t_batch_policy m_batch_policy;
+    t_batch_stats m_batch_stats;
+
+    // Consecutive small updates counted by `_shrink_tables`, and the
+    // largest of them
+    t_shrink_policy m_shrink_policy;
+    t_uindex m_shrink_small_updates;
+    t_uindex m_shrink_recent_rows;
+
+    std::shared_ptr<t_metrics> m_metrics;
+    std::string m_metrics_prefix;
+
+    // Estimated size of one row in an input port, for `m_max_bytes`
+    t_uindex m_input_row_bytes;
+
+    // When the first fragment of the pending batch arrived, by port id
+    std::map<t_uindex, std::chrono::high_resolution_clock::time_point> m_pending_since;
+
 #ifdef PSP_ENABLE_PYTHON
     std::thread::id m_event_loop_thread_id;
 #endif
@@ -414,7 +564,7 @@ private:
  * @param ctxh
  */
 template <typename CTX_T>
-void
+bool
 t_gnode::notify_context(const t_data_table& flattened, const t_ctx_handle& ctxh) {
     CTX_T* ctx = ctxh.get<CTX_T>();
     // These tables are guaranteed to have all computed columns.
@@ -424,6 +574,7 @@ t_gnode::notify_context(const t_data_table& flattened, const t_ctx_handle& ctxh)
     const t_data_table& transitions = *(m_oports[PSP_PORT_TRANSITIONS]->get_table().get());
     const t_data_table& existed = *(m_oports[PSP_PORT_EXISTED]->get_table().get());
     notify_context<CTX_T>(ctx, flattened, delta, prev, current, transitions, existed);
+    return ctx->has_deltas();
 }
 
 /**
@@ -449,11 +600,22 @@ t_gnode::notify_context(CTX_T* ctx, const t_data_table& flattened, const t_data_
     auto ctx_config = ctx->get_config();
     auto computed_columns = ctx_config.get_computed_columns();
 
+    std::string prefix;
+    if (m_metrics != nullptr && m_metrics->is_enabled()) {
+        prefix = m_metrics_prefix + "ctx." + ctx->get_name() + ".";
+    }
+
     ctx->step_begin();
-    // Flattened has the computed columns at this point, as it has
-    // passed through the body of `process_table`.
-    ctx->notify(flattened, delta, prev, current, transitions, existed);
-    ctx->step_end();
+    {
+        t_metrics_timer timer(m_metrics.get(), prefix, "notify");
+        // Flattened has the computed columns at this point, as it has
+        // passed through the body of `process_table`.
+        ctx->notify(flattened, delta, prev, current, transitions, existed);
+    }
+    {
+        t_metrics_timer timer(m_metrics.get(), prefix, "step_end");
+        ctx->step_end();
+    }
 }
 
 /**
@@ -17,6 +17,7 @@
 #include <perspective/mask.h>
 #include <perspective/sym_table.h>
 #include <perspective/rlookup.h>
+#include <perspective/memory_usage.h>
 
 namespace perspective {
 
@@ -60,6 +61,17 @@ public:
      */
     t_rlookup lookup(t_tscalar pkey) const;
 
+    /**
+     * @brief Look up the first `num_rows` primary keys of `pkey_col` in one
+     * pass, writing a `t_rlookup` for each row into `out`.
+     * 
+     * @param pkey_col 
+     * @param num_rows 
+     * @param out 
+     */
+    void lookup(const t_column* pkey_col, t_uindex num_rows,
+        std::vector<t_rlookup>& out) const;
+
     /**
      * @brief If the master table has 0 rows, fill it using `flattened`.
      * 
@@ -70,11 +82,15 @@ public:
     /**
      * @brief Update the master `t_data_table` with the flattened and masked
      * `t_data_table` after an `update` has been called and fully processed
-     * by `t_gnode::_process_table`.
+     * by `t_gnode::_process_table`. `lookup` holds the result of looking up
+     * each row of `flattened` before the update, so that existing rows are
+     * not hashed again and new rows can be allocated in one batch.
      * 
      * @param flattened 
+     * @param lookup 
      */
-    void update_master_table(const t_data_table* flattened);
+    void update_master_table(
+        const t_data_table* flattened, const std::vector<t_rlookup>& lookup);
 
     /**
      * @brief Given a column in the master data table and the corresponding
@@ -223,6 +239,14 @@ public:
      */
     t_uindex mapping_size() const;
 
+    /**
+     * @brief Add the bytes held by the master table and by the primary key
+     * mapping to `usage`, as `master_table` and `mapping`.
+     *
+     * @param usage
+     */
+    void get_memory_usage(t_memory_usage& usage) const;
+
     /**
      * @brief Resets the gnode state and its master `t_data_table` and
      * mapping.
@@ -266,6 +290,70 @@ protected:
      */
     t_uindex lookup_or_create(const t_tscalar& pkey);
 
+    /**
+     * @brief Allocate a row in the master table for each pkey in `pkeys`,
+     * taking rows from the free list first and appending the rest, and
+     * write the new row indices into `master_table_indexes` at `rows`.
+     * 
+     * @param pkeys 
+     * @param rows 
+     * @param master_table_indexes 
+     */
+    void create_rows(const std::vector<t_tscalar>& pkeys,
+        const std::vector<t_uindex>& rows,
+        std::vector<t_uindex>& master_table_indexes);
+
+    /**
+     * @brief Write the valid and cleared values of `flattened_column` into
+     * `master_column` at `master_table_indexes`, copying raw values of type
+     * `T`. A contiguous run of valid inserts is copied with a single
+     * `memcpy`.
+     * 
+     * @tparam T 
+     * @param master_column 
+     * @param flattened_column 
+     * @param op_column 
+     * @param master_table_indexes 
+     * @param num_rows 
+     */
+    template <typename T>
+    void update_master_column_helper(
+        t_column* master_column,
+        const t_column* flattened_column,
+        const t_column* op_column,
+        const std::vector<t_uindex>& master_table_indexes,
+        t_uindex num_rows);
+
+    /**
+     * @brief Look up each pkey in `pkeys`, writing the row index of every
+     * pkey found into `row_indices` and its position in `pkeys` into
+     * `positions`.
+     * 
+     * @param pkeys 
+     * @param row_indices 
+     * @param positions 
+     */
+    void lookup_rows(const std::vector<t_tscalar>& pkeys,
+        std::vector<t_uindex>& row_indices, std::vector<t_uindex>& positions) const;
+
+    /**
+     * @brief Read `num_rows` values of `column` into `out`, from the rows in
+     * `row_indices`, or from the contiguous rows starting at `start_idx` if
+     * `row_indices` is null.
+     * 
+     * @param column 
+     * @param row_indices 
+     * @param start_idx 
+     * @param num_rows 
+     * @param out 
+     */
+    void gather_column(const t_column* column, const t_uindex* row_indices,
+        t_uindex start_idx, t_uindex num_rows, t_tscalar* out) const;
+
+    template <typename RAW_T, typename VALUE_T>
+    void gather_column_helper(const t_column* column, const t_uindex* row_indices,
+        t_uindex start_idx, t_uindex num_rows, t_tscalar* out) const;
+
     /**
      * @brief Clear the value at `pkey` for every column in the table.
      * 
@@ -317,4 +405,80 @@ t_gstate::reduce(
     return fn(data);
 }
 
+template <typename T>
+void
+t_gstate::update_master_column_helper(
+    t_column* master_column,
+    const t_column* flattened_column,
+    const t_column* op_column,
+    const std::vector<t_uindex>& master_table_indexes,
+    t_uindex num_rows) {
+    if (num_rows == 0) {
+        return;
+    }
+
+    const T* src = flattened_column->get_nth<T>(0);
+    const t_status* src_status = flattened_column->get_nth_status(0);
+    const std::uint8_t* op_base = op_column->get_nth<std::uint8_t>(0);
+    T* dest = master_column->get_nth<T>(0);
+    bool status_enabled = master_column->is_status_enabled();
+
+    // Appending a block of new rows that are all valid inserts - copy the
+    // values in one go.
+    t_uindex first_idx = master_table_indexes[0];
+    bool contiguous = true;
+
+    for (t_uindex idx = 0; idx < num_rows && contiguous; ++idx) {
+        contiguous = master_table_indexes[idx] == first_idx + idx
+            && op_base[idx] == OP_INSERT && src_status[idx] == STATUS_VALID;
+    }
+
+    if (contiguous) {
+        std::memcpy(dest + first_idx, src, num_rows * sizeof(T));
+        if (status_enabled) {
+            for (t_uindex idx = 0; idx < num_rows; ++idx) {
+                master_column->set_status(first_idx + idx, STATUS_VALID);
+            }
+        }
+        return;
+    }
+
+    for (t_uindex idx = 0; idx < num_rows; ++idx) {
+        if (op_base[idx] == OP_DELETE)
+            continue;
+
+        t_uindex master_table_idx = master_table_indexes[idx];
+
+        switch (src_status[idx]) {
+            case STATUS_VALID: {
+                dest[master_table_idx] = src[idx];
+                if (status_enabled)
+                    master_column->set_status(master_table_idx, STATUS_VALID);
+            } break;
+            case STATUS_CLEAR: {
+                master_column->clear(master_table_idx);
+            } break;
+            default: break;
+        }
+    }
+}
+
+template <typename RAW_T, typename VALUE_T>
+void
+t_gstate::gather_column_helper(const t_column* column, const t_uindex* row_indices,
+    t_uindex start_idx, t_uindex num_rows, t_tscalar* out) const {
+    const RAW_T* base = column->get_nth<RAW_T>(0);
+    const t_status* status = 
+        column->is_status_enabled() ? column->get_nth_status(0) : nullptr;
+
+    for (t_uindex idx = 0; idx < num_rows; ++idx) {
+        t_uindex ridx = row_indices ? row_indices[idx] : start_idx + idx;
+        t_tscalar& rv = out[idx];
+        rv.clear();
+        rv.set(VALUE_T(base[ridx]));
+        if (status)
+            rv.m_status = status[ridx];
+    }
+}
+
 } // end namespace perspective
@@ -0,0 +1,124 @@
+/******************************************************************************
+ *
+ * Copyright (c) 2019, the Perspective Authors.
+ *
+ * This file is part of the Perspective library, distributed under the terms of
+ * the Apache License 2.0.  The full license can be found in the LICENSE file.
+ *
+ */
+
+#pragma once
+#include <perspective/first.h>
+#include <perspective/base.h>
+#include <perspective/exports.h>
+#include <perspective/data_table.h>
+#include <perspective/date_parser.h>
+#include <perspective/last.h>
+
+// Let rapidjson skip whitespace between tokens with SIMD where the target
+// supports it. These must be consistent across every translation unit that
+// includes rapidjson, so they are only set here.
+#if !defined(RAPIDJSON_SSE42) && !defined(RAPIDJSON_SSE2) && !defined(RAPIDJSON_NEON)
+#if defined(__SSE4_2__)
+#define RAPIDJSON_SSE42
+#elif defined(__SSE2__)
+#define RAPIDJSON_SSE2
+#elif defined(__ARM_NEON)
+#define RAPIDJSON_NEON
+#endif
+#endif
+
+#include <rapidjson/document.h>
+
+namespace perspective {
+namespace json {
+
+    /**
+     * @brief The shape of a JSON dataset.
+     *
+     * - JSON_FORMAT_RECORDS: an array of row objects, a single row object,
+     *   or newline-delimited row objects.
+     * - JSON_FORMAT_COLUMNS: an object mapping column names to arrays.
+     */
+    enum t_json_format { JSON_FORMAT_RECORDS, JSON_FORMAT_COLUMNS };
+
+    /**
+     * @brief Loads a JSON or NDJSON text directly into a `t_data_table`,
+     * without marshalling each cell through the binding language.
+     */
+    class PERSPECTIVE_EXPORT JsonLoader {
+    public:
+        JsonLoader();
+        ~JsonLoader();
+
+        /**
+         * @brief Parse `json` and infer its column names and types. The
+         * text is parsed in place, so the loader takes ownership of it.
+         *
+         * @param json
+         */
+        void initialize(std::string json);
+
+        /**
+         * @brief Given a data table, load the parsed JSON into it. Columns
+         * that are not in `input_schema` are skipped, and values are
+         * converted to the type `input_schema` declares for their column.
+         *
+         * @param tbl
+         * @param input_schema
+         * @param index
+         * @param offset
+         * @param limit
+         * @param is_update
+         */
+        void fill_table(
+            t_data_table& tbl,
+            const t_schema& input_schema,
+            const std::string& index,
+            std::uint32_t offset,
+            std::uint32_t limit,
+            bool is_update);
+
+        std::vector<std::string> names() const;
+        std::vector<t_dtype> types() const;
+        std::uint32_t row_count() const;
+        t_json_format format() const;
+
+    private:
+        void parse_records(const rapidjson::Value& records);
+        void parse_columns(const rapidjson::Value& columns);
+        t_dtype infer_type(t_uindex cidx) const;
+
+        /**
+         * @brief The value of column `cidx` at row `ridx`, or nullptr if the
+         * row does not have a value for the column.
+         *
+         * @param cidx
+         * @param ridx
+         * @return const rapidjson::Value*
+         */
+        const rapidjson::Value* get_cell(t_uindex cidx, t_uindex ridx) const;
+
+        void fill_column(
+            std::shared_ptr<t_column> col,
+            t_uindex cidx,
+            t_dtype type,
+            bool is_update) const;
+
+        std::string m_buffer;
+        rapidjson::Document m_document;
+        t_json_format m_format;
+        std::uint32_t m_row_count;
+        std::vector<std::string> m_names;
+        std::vector<t_dtype> m_types;
+
+        // For JSON_FORMAT_RECORDS, the value of each column in each row
+        std::vector<std::vector<const rapidjson::Value*>> m_cells;
+
+        // For JSON_FORMAT_COLUMNS, the array of each column
+        std::vector<const rapidjson::Value*> m_columns;
+        t_date_parser m_date_parser;
+    };
+
+} // namespace json
+} // namespace perspective
@@ -0,0 +1,61 @@
+/******************************************************************************
+ *
+ * Copyright (c) 2017, the Perspective Authors.
+ *
+ * This file is part of the Perspective library, distributed under the terms of
+ * the Apache License 2.0.  The full license can be found in the LICENSE file.
+ *
+ */
+
+#pragma once
+#include <perspective/first.h>
+#include <perspective/raw_types.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace perspective {
+
+/**
+ * @brief Bytes held by a table, view or context, by category, i.e.
+ * `master_table`, `transitional_tables`, `tree` or `traversal`.
+ *
+ * Sizes are of allocated capacity rather than of the data in use. Container
+ * overhead for node-based and hashed containers is estimated from their
+ * element counts, so reports are approximate but cheap to compute.
+ */
+typedef std::map<std::string, t_uindex> t_memory_usage;
+
+/**
+ * @brief Estimated bytes held by a `std::vector`, excluding any memory owned
+ * by its elements.
+ */
+template <typename T>
+t_uindex
+vector_memory_usage(const std::vector<T>& vec) {
+    return vec.capacity() * sizeof(T);
+}
+
+/**
+ * @brief Estimated bytes held by a hashed container with a `bucket_count`,
+ * excluding any memory owned by its elements.
+ */
+template <typename HASH_T>
+t_uindex
+hash_memory_usage(const HASH_T& container) {
+    return container.bucket_count() * (sizeof(typename HASH_T::value_type) + sizeof(void*));
+}
+
+/**
+ * @brief Estimated bytes held by a node-based container with `nindices`
+ * indices over each element, i.e. a `std::map` or a
+ * `boost::multi_index_container`.
+ */
+template <typename NODE_T>
+t_uindex
+node_memory_usage(const NODE_T& container, t_uindex nindices = 1) {
+    return container.size()
+        * (sizeof(typename NODE_T::value_type) + nindices * 3 * sizeof(void*));
+}
+
+} // end namespace perspective
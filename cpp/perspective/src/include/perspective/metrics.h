@@ -0,0 +1,170 @@
+/******************************************************************************
+ *
+ * Copyright (c) 2017, the Perspective Authors.
+ *
+ * This file is part of the Perspective library, distributed under the terms of
+ * the Apache License 2.0.  The full license can be found in the LICENSE file.
+ *
+ */
+
+#pragma once
+#include <perspective/first.h>
+#include <perspective/base.h>
+#include <perspective/exports.h>
+#include <perspective/tracing.h>
+#include <atomic>
+#include <map>
+#include <mutex>
+
+namespace perspective {
+
+#define PSP_METRICS_TRACE_CAPACITY 100000
+
+/**
+ * @brief The distribution of values recorded for one histogram metric, in
+ * power-of-two buckets.
+ */
+struct PERSPECTIVE_EXPORT t_metric_histogram {
+    t_metric_histogram();
+
+    void record(std::int64_t value);
+    double mean() const;
+
+    /**
+     * @brief An upper bound on the `p`th percentile (0 - 1) of the recorded
+     * values, accurate to the power of two containing it.
+     *
+     * @param p
+     * @return std::int64_t
+     */
+    std::int64_t percentile(double p) const;
+
+    t_uindex m_count;
+    std::int64_t m_sum;
+    std::int64_t m_min;
+    std::int64_t m_max;
+
+    // Bucket `i` counts the values in [2^(i - 1), 2^i), and bucket 0 the
+    // values <= 0.
+    std::vector<t_uindex> m_buckets;
+};
+
+/**
+ * @brief A registry of named counters, gauges and histograms for the engine,
+ * owned by a `t_pool`. Metrics are only recorded once enabled, so an idle
+ * registry costs one relaxed load per instrumented stage.
+ *
+ * Metric names are dotted paths, e.g. `gnode.0.flatten` or
+ * `gnode.0.ctx.view_1.notify`, so costs can be attributed to a specific
+ * table or view. Durations are recorded in nanoseconds.
+ */
+class PERSPECTIVE_EXPORT t_metrics {
+public:
+    PSP_NON_COPYABLE(t_metrics);
+
+    t_metrics();
+
+    void set_enabled(bool enabled);
+    bool is_enabled() const;
+
+    /**
+     * @brief Keep the last `capacity` recorded durations as trace records,
+     * which can be exported with `to_chrome_trace`. Recording durations
+     * also enables the registry.
+     *
+     * @param enabled
+     * @param capacity
+     */
+    void set_tracing(bool enabled, t_uindex capacity = PSP_METRICS_TRACE_CAPACITY);
+    bool is_tracing() const;
+
+    void increment(const std::string& name, std::int64_t delta = 1);
+    void set_gauge(const std::string& name, std::int64_t value);
+    void record(const std::string& name, std::int64_t value);
+
+    /**
+     * @brief Record the duration of a stage in the `name` histogram, and as
+     * a trace record if tracing is enabled.
+     *
+     * @param name
+     * @param begin_ns - nanoseconds on `std::chrono::steady_clock`
+     * @param end_ns
+     */
+    void record_duration(const std::string& name, std::int64_t begin_ns, std::int64_t end_ns);
+
+    /**
+     * @brief The current value of every counter and gauge.
+     *
+     * @return std::map<std::string, std::int64_t>
+     */
+    std::map<std::string, std::int64_t> get_counters() const;
+    std::map<std::string, t_metric_histogram> get_histograms() const;
+
+    /**
+     * @brief Serialize every counter, gauge and histogram summary to JSON.
+     *
+     * @return std::string
+     */
+    std::string to_json() const;
+
+    /**
+     * @brief Serialize the retained trace records to the Chrome trace event
+     * format, for `chrome://tracing` or Perfetto.
+     *
+     * @return std::string
+     */
+    std::string to_chrome_trace() const;
+
+    void reset();
+
+private:
+    std::atomic<bool> m_enabled;
+    std::atomic<bool> m_tracing;
+
+    mutable std::mutex m_mtx;
+    std::map<std::string, std::int64_t> m_counters;
+    std::map<std::string, t_metric_histogram> m_histograms;
+
+    // Trace records refer to names by index, through `t_instrec::m_id`
+    std::map<std::string, std::uint64_t> m_trace_ids;
+    std::vector<std::string> m_trace_names;
+
+    // A ring buffer of the most recent trace records
+    std::vector<t_instrec> m_trace;
+    t_uindex m_trace_capacity;
+    t_uindex m_trace_head;
+};
+
+/**
+ * @brief Records the time between its construction and destruction as the
+ * duration of `prefix + stage`, if `metrics` is non-null and enabled.
+ */
+class PERSPECTIVE_EXPORT t_metrics_timer {
+public:
+    PSP_NON_COPYABLE(t_metrics_timer);
+
+    t_metrics_timer(t_metrics* metrics, const std::string& prefix, const char* stage);
+    ~t_metrics_timer();
+
+private:
+    t_metrics* m_metrics;
+    std::string m_name;
+    std::int64_t m_begin;
+};
+
+/**
+ * @brief Serialize `t_instrec` records to the Chrome trace event format.
+ * Two-sided durations become complete (`X`) events named by
+ * `names[m_id]`, with the OS thread id stored in the first 8 bytes of
+ * `t_fntrace.m_payload` by `t_metrics::record_duration`.
+ * Other records are named by their payload.
+ *
+ * @param records
+ * @param nrecords
+ * @param names
+ * @return std::string
+ */
+PERSPECTIVE_EXPORT std::string instrecs_to_chrome_trace(
+    const t_instrec* records, t_uindex nrecords, const std::vector<std::string>& names);
+
+} // end namespace perspective
@@ -0,0 +1,97 @@
+/******************************************************************************
+ *
+ * Copyright (c) 2017, the Perspective Authors.
+ *
+ * This file is part of the Perspective library, distributed under the terms of
+ * the Apache License 2.0.  The full license can be found in the LICENSE file.
+ *
+ */
+
+#pragma once
+#include <perspective/first.h>
+#include <perspective/base.h>
+#include <atomic>
+#include <vector>
+
+namespace perspective {
+
+/**
+ * @brief A lock-free multi-producer, single-consumer queue. Producers push
+ * onto an atomic stack; the consumer takes the whole stack in one exchange
+ * and reverses it, so values are drained in the order they were pushed.
+ *
+ * @tparam T
+ */
+template <typename T>
+class t_mpsc_queue {
+public:
+    PSP_NON_COPYABLE(t_mpsc_queue);
+
+    t_mpsc_queue()
+        : m_head(nullptr) {}
+
+    ~t_mpsc_queue() {
+        t_node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+        while (node) {
+            t_node* next = node->m_next;
+            delete node;
+            node = next;
+        }
+    }
+
+    /**
+     * @brief Push `value` onto the queue. Safe to call from any thread.
+     *
+     * @param value
+     */
+    void
+    push(T value) {
+        t_node* node = new t_node{std::move(value), m_head.load(std::memory_order_relaxed)};
+        while (!m_head.compare_exchange_weak(
+            node->m_next, node, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Move every queued value onto the end of `out`, oldest first,
+     * returning whether any value was drained. Only one thread may drain.
+     *
+     * @param out
+     * @return bool
+     */
+    bool
+    drain(std::vector<T>& out) {
+        t_node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+        if (!node) {
+            return false;
+        }
+
+        std::vector<t_node*> nodes;
+        for (; node; node = node->m_next) {
+            nodes.push_back(node);
+        }
+
+        out.reserve(out.size() + nodes.size());
+        for (auto iter = nodes.rbegin(); iter != nodes.rend(); ++iter) {
+            out.push_back(std::move((*iter)->m_value));
+            delete *iter;
+        }
+
+        return true;
+    }
+
+    bool
+    empty() const {
+        return m_head.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct t_node {
+        T m_value;
+        t_node* m_next;
+    };
+
+    std::atomic<t_node*> m_head;
+};
+
+} // end namespace perspective
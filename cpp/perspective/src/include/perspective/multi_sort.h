@@ -167,4 +167,22 @@ struct PERSPECTIVE_EXPORT t_multisorter {
     std::shared_ptr<const std::vector<t_mselem>> m_elems;
 };
 
+/**
+ * @brief The permutation which sorts `elems` into the same order as
+ * `t_multisorter`, i.e. element `i` of the sorted sequence is
+ * `elems[rval[i]]`.
+ *
+ * Sort values are first encoded into fixed-width, order-preserving unsigned
+ * keys per column (strings by their rank among the distinct strings in the
+ * column), which are radix sorted. Encoding stops at the first column that
+ * `cmp_mselem` does not compare by value alone, e.g. an absolute sort, and
+ * runs of rows with equal keys are then ordered by `cmp_mselem`.
+ *
+ * @param elems
+ * @param sort_order
+ * @return std::vector<t_uindex>
+ */
+PERSPECTIVE_EXPORT std::vector<t_uindex> multisort_indices(
+    const std::vector<t_mselem>& elems, const std::vector<t_sorttype>& sort_order);
+
 } // end namespace perspective
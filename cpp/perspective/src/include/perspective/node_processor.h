@@ -52,6 +52,7 @@ t_pivot_processor<DTYPE_T>::operator()(const t_column* data, std::vector<t_dense
     t_uindex* lcopy_ptr = lcopy.get_nth<t_uindex>(0);
     t_uindex lvl_nidx = neidx;
     t_uindex offset = 0;
+    t_partition_buffers partition_buffers;
 
     for (t_uindex nidx = nbidx; nidx < neidx; ++nidx) {
         t_dense_tnode* pnode = &nodes->at(nidx);
@@ -61,7 +62,7 @@ t_pivot_processor<DTYPE_T>::operator()(const t_column* data, std::vector<t_dense
         t_spanvvec spanvec;
         {
             t_spanvec spans;
-            partition(data, leaves, cbidx, ceidx, spans);
+            partition(data, leaves, cbidx, ceidx, spans, partition_buffers);
             spanvec.push_back(spans);
         }
 
@@ -15,20 +15,38 @@
 #include <perspective/node_processor_types.h>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
-/*
-TODO improvements
+namespace perspective {
 
-1. Remove allocations in partition using one of the
-following
-approaches
+/**
+ * @brief Scratch space for `partition`, allocated once by the caller and
+ * reused for every node it partitions.
+ */
+struct t_partition_buffers {
+    std::vector<std::uint64_t> m_keys;
+    std::vector<std::uint64_t> m_tmp_keys;
+    std::vector<t_uindex> m_leaves;
+    std::vector<t_uindex> m_tmp_leaves;
+    std::vector<t_uindex> m_counts;
+};
 
-    a. Direct mapping tid offset into global buffer
-    b. TLS
-    c. ...?
-*/
+// Map a value onto an unsigned key with the same ordering
+template <typename DATA_T>
+inline std::uint64_t
+to_radix_key(DATA_T value) {
+    if (std::is_signed<DATA_T>::value) {
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(value))
+            ^ (std::uint64_t(1) << 63);
+    }
+    return static_cast<std::uint64_t>(value);
+}
 
-namespace perspective {
+template <>
+inline std::uint64_t
+to_radix_key<bool>(bool value) {
+    return value ? 1 : 0;
+}
 
 template <typename DATA_T>
 struct t_argsort_cmp {
@@ -55,7 +73,7 @@ argsort(const DATA_T* b, std::vector<t_uindex>& output) {
 }
 
 inline void
-partition(const t_column* PSP_RESTRICT data_, t_column* PSP_RESTRICT leaves_, t_uindex bidx,
+partition_scalar(const t_column* PSP_RESTRICT data_, t_column* PSP_RESTRICT leaves_, t_uindex bidx,
     t_uindex eidx, std::vector<t_chunk_value_span<t_tscalar>>& out_spans) {
     t_uindex* leaves = leaves_->get_nth<t_uindex>(0);
     typedef t_chunk_value_span<t_tscalar> t_cvs;
@@ -125,4 +143,235 @@ partition(const t_column* PSP_RESTRICT data_, t_column* PSP_RESTRICT leaves_, t_
     }
 }
 
+/**
+ * @brief Stable sort `bufs.m_leaves` by `(status, bufs.m_keys)`, the same
+ * order `t_tscalar` uses. Key bytes that are equal for every leaf are
+ * skipped, so narrow and low-cardinality keys take few passes.
+ */
+inline void
+radix_sort_leaves(const t_status* status, bool has_invalid, t_partition_buffers& bufs) {
+    std::vector<std::uint64_t>& keys = bufs.m_keys;
+    std::vector<t_uindex>& leaves = bufs.m_leaves;
+    t_uindex nelems = keys.size();
+
+    bufs.m_tmp_keys.resize(nelems);
+    bufs.m_tmp_leaves.resize(nelems);
+    bufs.m_counts.resize(256);
+
+    std::uint64_t diff = 0;
+    for (t_uindex i = 1; i < nelems; ++i) {
+        diff |= keys[i] ^ keys[0];
+    }
+
+    for (t_uindex shift = 0; shift < 64; shift += 8) {
+        if (((diff >> shift) & 0xff) == 0)
+            continue;
+
+        std::fill(bufs.m_counts.begin(), bufs.m_counts.end(), 0);
+        for (t_uindex i = 0; i < nelems; ++i) {
+            ++bufs.m_counts[(keys[i] >> shift) & 0xff];
+        }
+
+        t_uindex offset = 0;
+        for (t_uindex& count : bufs.m_counts) {
+            t_uindex c = count;
+            count = offset;
+            offset += c;
+        }
+
+        for (t_uindex i = 0; i < nelems; ++i) {
+            t_uindex pos = bufs.m_counts[(keys[i] >> shift) & 0xff]++;
+            bufs.m_tmp_keys[pos] = keys[i];
+            bufs.m_tmp_leaves[pos] = leaves[i];
+        }
+
+        std::swap(keys, bufs.m_tmp_keys);
+        std::swap(leaves, bufs.m_tmp_leaves);
+    }
+
+    // Status is the most significant part of the ordering
+    if (has_invalid) {
+        t_uindex counts[3] = {0, 0, 0};
+        for (t_uindex i = 0; i < nelems; ++i) {
+            ++counts[status[leaves[i]]];
+        }
+
+        t_uindex offsets[3] = {0, counts[0], counts[0] + counts[1]};
+        for (t_uindex i = 0; i < nelems; ++i) {
+            t_uindex pos = offsets[status[leaves[i]]]++;
+            bufs.m_tmp_keys[pos] = keys[i];
+            bufs.m_tmp_leaves[pos] = leaves[i];
+        }
+
+        std::swap(keys, bufs.m_tmp_keys);
+        std::swap(leaves, bufs.m_tmp_leaves);
+    }
+}
+
+/**
+ * @brief Load the keys of the leaves in `[bidx, eidx)` into `bufs` and sort
+ * them, returning whether any leaf is not `STATUS_VALID`.
+ */
+template <typename DATA_T>
+inline bool
+sort_leaves(const t_column* data_, const t_uindex* leaves, t_uindex bidx, t_uindex eidx,
+    const t_status* status, t_partition_buffers& bufs) {
+    t_uindex nelems = eidx - bidx;
+    const DATA_T* base = data_->get_nth<DATA_T>(0);
+
+    bufs.m_keys.resize(nelems);
+    bufs.m_leaves.resize(nelems);
+
+    bool has_invalid = false;
+    for (t_uindex i = 0; i < nelems; ++i) {
+        t_uindex leaf = leaves[bidx + i];
+        bufs.m_leaves[i] = leaf;
+        bufs.m_keys[i] = to_radix_key<DATA_T>(base[leaf]);
+        has_invalid = has_invalid || (status && status[leaf] != STATUS_VALID);
+    }
+
+    radix_sort_leaves(status, has_invalid, bufs);
+    return has_invalid;
+}
+
+/**
+ * @brief Partition the leaves of a fixed-width column in `[bidx, eidx)` by
+ * value, comparing raw values rather than `t_tscalar`s.
+ */
+template <typename DATA_T>
+inline void
+partition_radix(const t_column* PSP_RESTRICT data_, t_column* PSP_RESTRICT leaves_,
+    t_uindex bidx, t_uindex eidx, std::vector<t_chunk_value_span<t_tscalar>>& out_spans,
+    t_partition_buffers& bufs) {
+    typedef t_chunk_value_span<t_tscalar> t_cvs;
+    t_uindex* leaves = leaves_->get_nth<t_uindex>(0);
+    t_uindex nelems = eidx - bidx;
+    const t_status* status =
+        data_->is_status_enabled() ? data_->get_nth_status(0) : nullptr;
+
+    bool has_invalid = sort_leaves<DATA_T>(data_, leaves, bidx, eidx, status, bufs);
+    memcpy(leaves + bidx, bufs.m_leaves.data(), sizeof(t_uindex) * nelems);
+
+    t_uindex begin = 0;
+    for (t_uindex i = 1; i <= nelems; ++i) {
+        bool edge = i == nelems || bufs.m_keys[i] != bufs.m_keys[i - 1]
+            || (has_invalid && status[bufs.m_leaves[i]] != status[bufs.m_leaves[i - 1]]);
+
+        if (edge) {
+            out_spans.push_back(t_cvs());
+            fill_chunk_value_span<t_tscalar>(out_spans.back(),
+                data_->get_scalar(bufs.m_leaves[begin]), bidx + begin, bidx + i);
+            begin = i;
+        }
+    }
+}
+
+/**
+ * @brief Partition the leaves of a string column in `[bidx, eidx)` by vocab
+ * id, then order the partitions by string value.
+ */
+inline void
+partition_vocab(const t_column* PSP_RESTRICT data_, t_column* PSP_RESTRICT leaves_,
+    t_uindex bidx, t_uindex eidx, std::vector<t_chunk_value_span<t_tscalar>>& out_spans,
+    t_partition_buffers& bufs) {
+    typedef t_chunk_value_span<t_tscalar> t_cvs;
+    t_uindex* leaves = leaves_->get_nth<t_uindex>(0);
+    t_uindex nelems = eidx - bidx;
+    const t_status* status =
+        data_->is_status_enabled() ? data_->get_nth_status(0) : nullptr;
+
+    bool has_invalid = sort_leaves<t_uindex>(data_, leaves, bidx, eidx, status, bufs);
+
+    struct t_group {
+        t_status m_status;
+        const char* m_str;
+        t_uindex m_bidx;
+        t_uindex m_eidx;
+    };
+
+    std::vector<t_group> groups;
+    t_uindex begin = 0;
+    for (t_uindex i = 1; i <= nelems; ++i) {
+        bool edge = i == nelems || bufs.m_keys[i] != bufs.m_keys[i - 1]
+            || (has_invalid && status[bufs.m_leaves[i]] != status[bufs.m_leaves[i - 1]]);
+
+        if (edge) {
+            t_uindex leaf = bufs.m_leaves[begin];
+            t_status group_status = status ? status[leaf] : STATUS_VALID;
+            groups.push_back({group_status, data_->unintern_c(bufs.m_keys[begin]), begin, i});
+            begin = i;
+        }
+    }
+
+    std::stable_sort(groups.begin(), groups.end(), [](const t_group& a, const t_group& b) {
+        if (a.m_status != b.m_status)
+            return a.m_status < b.m_status;
+        return strcmp(a.m_str, b.m_str) < 0;
+    });
+
+    t_uindex offset = bidx;
+    for (const t_group& group : groups) {
+        t_uindex len = group.m_eidx - group.m_bidx;
+        memcpy(leaves + offset, bufs.m_leaves.data() + group.m_bidx, sizeof(t_uindex) * len);
+        out_spans.push_back(t_cvs());
+        fill_chunk_value_span<t_tscalar>(
+            out_spans.back(), data_->get_scalar(leaves[offset]), offset, offset + len);
+        offset += len;
+    }
+}
+
+/**
+ * @brief Sort the leaves in `[bidx, eidx)` by their value in `data_`, and
+ * write one span per distinct value into `out_spans`.
+ */
+inline void
+partition(const t_column* PSP_RESTRICT data_, t_column* PSP_RESTRICT leaves_, t_uindex bidx,
+    t_uindex eidx, std::vector<t_chunk_value_span<t_tscalar>>& out_spans,
+    t_partition_buffers& bufs) {
+    if (eidx - bidx < 2) {
+        partition_scalar(data_, leaves_, bidx, eidx, out_spans);
+        return;
+    }
+
+    switch (data_->get_dtype()) {
+        case DTYPE_TIME:
+        case DTYPE_INT64: {
+            partition_radix<std::int64_t>(data_, leaves_, bidx, eidx, out_spans, bufs);
+        } break;
+        case DTYPE_INT32: {
+            partition_radix<std::int32_t>(data_, leaves_, bidx, eidx, out_spans, bufs);
+        } break;
+        case DTYPE_INT16: {
+            partition_radix<std::int16_t>(data_, leaves_, bidx, eidx, out_spans, bufs);
+        } break;
+        case DTYPE_INT8: {
+            partition_radix<std::int8_t>(data_, leaves_, bidx, eidx, out_spans, bufs);
+        } break;
+        case DTYPE_UINT64: {
+            partition_radix<std::uint64_t>(data_, leaves_, bidx, eidx, out_spans, bufs);
+        } break;
+        case DTYPE_DATE:
+        case DTYPE_UINT32: {
+            partition_radix<std::uint32_t>(data_, leaves_, bidx, eidx, out_spans, bufs);
+        } break;
+        case DTYPE_UINT16: {
+            partition_radix<std::uint16_t>(data_, leaves_, bidx, eidx, out_spans, bufs);
+        } break;
+        case DTYPE_UINT8: {
+            partition_radix<std::uint8_t>(data_, leaves_, bidx, eidx, out_spans, bufs);
+        } break;
+        case DTYPE_BOOL: {
+            partition_radix<bool>(data_, leaves_, bidx, eidx, out_spans, bufs);
+        } break;
+        case DTYPE_STR: {
+            partition_vocab(data_, leaves_, bidx, eidx, out_spans, bufs);
+        } break;
+        default: {
+            // Floating point scalars compare equal bitwise but order by
+            // value, so they keep the generic path.
+            partition_scalar(data_, leaves_, bidx, eidx, out_spans);
+        }
+    }
+}
+
 } // end namespace perspective
@@ -12,11 +12,14 @@
 #include <perspective/data_table.h>
 #include <perspective/gnode.h>
 #include <perspective/exports.h>
+#include <perspective/mpsc_queue.h>
+#include <perspective/metrics.h>
 #include <mutex>
 #include <atomic>
 
-#ifdef PSP_ENABLE_PYTHON
+#ifndef PSP_ENABLE_WASM
 #include <thread>
+#include <condition_variable>
 #endif
 
 #if defined PSP_ENABLE_WASM
@@ -82,14 +85,99 @@ public:
 
     void send(t_uindex gnode_id, t_uindex port_id, const t_data_table& table);
 
+    /**
+     * @brief Send a table the caller no longer needs; an empty input port
+     * takes its columns without copying them.
+     *
+     * @param gnode_id
+     * @param port_id
+     * @param table
+     */
+    void send(t_uindex gnode_id, t_uindex port_id, t_data_table&& table);
+
     void _process();
 
+#ifndef PSP_ENABLE_WASM
+    /**
+     * @brief Start a dedicated engine thread which owns this pool's gnodes.
+     * While it runs, fragments are handed to it through `enqueue`, and every
+     * `interval_ms` milliseconds it sends all queued fragments to their
+     * ports and processes each port once. With an interval of 0, queued
+     * fragments are processed as soon as the engine thread wakes.
+     *
+     * The engine thread holds the pool lock while processing, and notifies
+     * userspace after releasing it. Reads of gnodes and contexts from other
+     * threads must hold `lock`. In Python, the engine cannot be used
+     * together with `set_event_loop`.
+     * 
+     * @param interval_ms 
+     */
+    void start_engine(t_uindex interval_ms);
+
+    /**
+     * @brief Stop the engine thread, processing any fragments still queued
+     * before returning.
+     */
+    void stop_engine();
+
+    bool is_engine_running() const;
+
+    /**
+     * @brief Queue `table` to be sent to `port_id` of `gnode_id` by the
+     * engine thread. Never waits on processing.
+     * 
+     * @param gnode_id 
+     * @param port_id 
+     * @param table 
+     */
+    void enqueue(t_uindex gnode_id, t_uindex port_id, std::shared_ptr<t_data_table> table);
+
+    /**
+     * @brief Set how long the engine thread lets updates accumulate on the
+     * ports of `gnode_id` before processing them.
+     *
+     * Only the engine thread honors the policy, so it can only be set while
+     * the engine is running. `_process` has no later call to defer a batch
+     * to, and `stop_engine` flushes every pending batch, so neither waits.
+     * 
+     * @param gnode_id 
+     * @param policy 
+     */
+    void set_batch_policy(t_uindex gnode_id, const t_batch_policy& policy);
+
+    /**
+     * @brief Return the sizes and latencies of the batches processed by
+     * `gnode_id` so far.
+     * 
+     * @param gnode_id 
+     * @return t_batch_stats 
+     */
+    t_batch_stats get_batch_stats(t_uindex gnode_id);
+#endif
+
+    /**
+     * @brief Set when `gnode_id` releases the capacity of its input port and
+     * transitional tables after a spike.
+     * 
+     * @param gnode_id 
+     * @param policy 
+     */
+    void set_shrink_policy(t_uindex gnode_id, const t_shrink_policy& policy);
+
     void init();
     void stop();
     void set_sleep(t_uindex ms);
     std::vector<t_stree*> get_trees();
 
     bool get_data_remaining() const;
+
+    /**
+     * @brief Publish the contexts which had deltas when their gnode was
+     * notified since the last call, and clear them, as
+     * `get_gnodes_last_updated` does for gnodes.
+     *
+     * @return std::vector<t_updctx>
+     */
     std::vector<t_updctx> get_contexts_last_updated();
     std::string repr() const;
 
@@ -100,6 +188,28 @@ public:
     std::vector<t_uindex> get_gnodes_last_updated();
     t_gnode* get_gnode(t_uindex gnode_id);
 
+    /**
+     * @brief Lock the pool against the engine thread, which processes
+     * updates while holding this lock. Views hold it while reading or
+     * configuring their context, and tables while reading their gnode. The
+     * lock is recursive, so it can be held across calls that lock the pool.
+     *
+     * Without the engine, `_process` runs on the caller's thread and does
+     * not take this lock, so it only contends with `send`.
+     *
+     * @return std::unique_lock<std::recursive_mutex>
+     */
+    std::unique_lock<std::recursive_mutex> lock();
+
+    /**
+     * @brief The metrics registry shared by every gnode registered to this
+     * pool, and by the views built on them. Disabled until
+     * `set_enabled(true)` is called on it.
+     *
+     * @return std::shared_ptr<t_metrics>
+     */
+    std::shared_ptr<t_metrics> get_metrics() const;
+
 protected:
 
     // Unused methods
@@ -111,10 +221,33 @@ protected:
     bool validate_gnode_id(t_uindex gnode_id) const;
 
 private:
+#ifndef PSP_ENABLE_WASM
+    struct t_fragment {
+        t_uindex m_gnode_id;
+        t_uindex m_port_id;
+        std::shared_ptr<t_data_table> m_table;
+    };
+
+    void _engine_loop();
+    t_uindex _process_engine_queue(bool flush);
+#endif
+
+    /**
+     * @brief Mark data as remaining and log `table`, then return the gnode
+     * either `send` overload writes it to, or nullptr if `gnode_id` has
+     * been unregistered. Must be called holding `m_mtx`.
+     *
+     * @param gnode_id
+     * @param port_id
+     * @param table
+     * @return t_gnode*
+     */
+    t_gnode* _get_send_gnode(t_uindex gnode_id, t_uindex port_id, const t_data_table& table);
+
 #ifdef PSP_ENABLE_PYTHON
     std::thread::id m_event_loop_thread_id;
 #endif
-    std::mutex m_mtx;
+    std::recursive_mutex m_mtx;
     std::vector<t_gnode*> m_gnodes;
 
 #if defined PSP_ENABLE_WASM || defined PSP_ENABLE_PYTHON
@@ -124,6 +257,16 @@ private:
     std::atomic<bool> m_data_remaining;
     std::atomic<t_uindex> m_sleep;
     std::atomic<t_uindex> m_epoch;
+
+#ifndef PSP_ENABLE_WASM
+    t_mpsc_queue<t_fragment> m_engine_queue;
+    std::thread m_engine_thread;
+    std::mutex m_engine_mtx;
+    std::condition_variable m_engine_cv;
+    std::atomic<bool> m_engine_running;
+    std::atomic<t_uindex> m_engine_interval;
+#endif
+    std::shared_ptr<t_metrics> m_metrics;
 };
 
 } // end namespace perspective
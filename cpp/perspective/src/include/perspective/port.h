@@ -31,8 +31,18 @@ public:
     void send(std::shared_ptr<const t_data_table> tbl);
     void send(const t_data_table& tbl);
 
+    // take the columns of `tbl` if the port is empty, otherwise append
+    void send(t_data_table&& tbl);
+
     t_schema get_schema() const;
 
+    /**
+     * @brief Bytes allocated for this port's table.
+     *
+     * @return t_uindex
+     */
+    t_uindex get_memory_usage() const;
+
     void release();
     void release_or_clear();
     void clear();
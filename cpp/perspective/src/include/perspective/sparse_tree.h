@@ -28,8 +28,11 @@ SUPPRESS_WARNINGS_VC(4503)
 #include <perspective/mask.h>
 #include <perspective/sym_table.h>
 #include <perspective/data_table.h>
+#include <perspective/memory_usage.h>
 #include <perspective/dense_tree.h>
+#include <tsl/hopscotch_map.h>
 #include <vector>
+#include <map>
 #include <algorithm>
 #include <deque>
 #include <sstream>
@@ -112,11 +115,47 @@ typedef t_idxpkey::index<by_idx_pkey>::type::iterator iter_by_idx_pkey;
 
 typedef std::pair<iter_by_idx_pkey, iter_by_idx_pkey> t_by_idx_pkey_ipair;
 
+/**
+ * @brief How many rows under a node hold each distinct value of a column,
+ * from which `AGGTYPE_DOMINANT`, `AGGTYPE_UNIQUE`, `AGGTYPE_AND` and
+ * `AGGTYPE_JOIN` are read without visiting the rows. NaNs are only counted,
+ * as they have no place in the ordering of `m_counts`.
+ */
+struct PERSPECTIVE_EXPORT t_value_counts {
+    t_value_counts();
+
+    void add(const t_tscalar& value);
+    void remove(const t_tscalar& value);
+    bool empty() const;
+
+    /**
+     * @brief The value `get_dominant` would return for the counted rows.
+     *
+     * @return t_tscalar
+     */
+    t_tscalar get_dominant() const;
+
+    std::map<t_tscalar, t_uindex> m_counts;
+    t_uindex m_nfalse;
+    t_uindex m_nnan;
+
+    // `AGGTYPE_JOIN` of the keys of `m_counts`, rebuilt when a key is added
+    // or removed.
+    t_tscalar m_joined;
+    bool m_joined_stale;
+};
+
+typedef tsl::hopscotch_map<t_uindex, t_value_counts> t_node_value_counts;
+
 struct PERSPECTIVE_EXPORT t_agg_update_info {
     std::vector<const t_column*> m_src;
     std::vector<t_column*> m_dst;
     std::vector<t_aggspec> m_aggspecs;
 
+    // Per column, the value counts by node of its dependency, or null if
+    // the column is not read from value counts.
+    std::vector<t_node_value_counts*> m_value_counts;
+
     std::vector<t_uindex> m_dst_topo_sorted;
 };
 
@@ -183,6 +222,14 @@ public:
 
     t_uindex size() const;
 
+    /**
+     * @brief Add the bytes held by this tree to `usage`, as `tree` for its
+     * nodes and indices, `aggregates`, `deltas` and `symtable`.
+     *
+     * @param usage
+     */
+    void get_memory_usage(t_memory_usage& usage) const;
+
     t_uindex get_num_children(t_uindex idx) const;
     void get_child_nodes(t_uindex idx, t_tnodevec& nodes) const;
     std::vector<t_uindex> zero_strands() const;
@@ -264,6 +311,25 @@ public:
     void clear_aggregates(const std::vector<t_uindex>& indices);
 
     std::pair<iter_by_idx, bool> insert_node(const t_tnode& node);
+
+    /**
+     * @brief Replace the node at `node.m_idx`, i.e. to move it under a new
+     * parent or change its sort value.
+     *
+     * @param node
+     * @return bool - false if no such node exists, or the replacement
+     * would duplicate a value under the same parent.
+     */
+    bool update_node(const t_tnode& node);
+
+    /**
+     * @brief Remove the node at `idx` from the tree. Its children, pkeys and
+     * aggregates are left to the caller.
+     *
+     * @param idx
+     */
+    void remove_node(t_uindex idx);
+
     bool has_deltas() const;
     void set_has_deltas(bool v);
 
@@ -295,7 +361,34 @@ protected:
     void populate_pkey_idx(const t_dtree_ctx& ctx, const t_dtree& dtree, t_uindex dptidx,
         t_uindex sptidx, t_uindex ndepth, t_idxpkey& new_idx_pkey);
 
+    /**
+     * @brief Take the rows touched by this update out of the value counts of
+     * the nodes they were counted under. Called while those nodes are still
+     * in the tree.
+     */
+    void unapply_value_counts();
+
+    /**
+     * @brief Count the current values of the rows touched by this update
+     * under the leaves they now belong to, and each of their ancestors.
+     *
+     * @param gstate
+     */
+    void apply_value_counts(const t_gstate& gstate);
+
+    /**
+     * @brief The value counts of column `idx` at node `nidx`, or null if the
+     * column is not read from value counts.
+     */
+    t_value_counts* get_value_counts(
+        const t_agg_update_info& info, t_uindex idx, t_uindex nidx);
+
 private:
+    struct t_counted_row {
+        t_uindex m_leaf;
+        std::vector<t_tscalar> m_values;
+    };
+
     std::vector<t_pivot> m_pivots;
     bool m_init;
     std::shared_ptr<t_treenodes> m_nodes;
@@ -317,6 +410,17 @@ private:
     t_symtable m_symtable;
     bool m_has_delta;
     std::string m_grand_agg_str;
+
+    // Dependencies of the aggregates read from value counts, and their
+    // counts by node.
+    std::vector<std::string> m_counted_columns;
+    std::vector<t_node_value_counts> m_value_counts;
+
+    // The leaf and values each row is counted with, and the leaf each row
+    // touched by the current update belongs to, or `INVALID_INDEX`.
+    tsl::hopscotch_map<t_tscalar, t_counted_row> m_counted_rows;
+    tsl::hopscotch_map<t_tscalar, t_index> m_counted_updates;
+    t_value_counts m_empty_counts;
 };
 
 
@@ -177,6 +177,14 @@ public:
 
     void append(const t_lstore& other);
 
+    // Point this store at `size` bytes of memory owned by `owner` instead of
+    // a private allocation. The store holds a reference to `owner` rather
+    // than freeing the memory itself, and drops it once the memory has been
+    // copied into a private allocation, the first time the store has to
+    // grow, be cleared or be refilled. Element writes through `set_nth`
+    // land directly in the adopted memory.
+    void adopt(void* base, t_uindex size, std::shared_ptr<void> owner);
+
     void clear();
 
     t_lstore_recipe get_recipe() const;
@@ -216,6 +224,7 @@ protected:
 
 private:
     void reserve_impl(t_uindex capacity, bool allow_shrink);
+    void detach();
     t_handle create_file();
     void* create_mapping();
     void resize_mapping(t_uindex cap_new);
@@ -241,13 +250,16 @@ private:
     t_uindex m_version;
     bool m_from_recipe;
 
+    // Keeps adopted external memory alive, null when `m_base` is owned
+    std::shared_ptr<void> m_owner;
+
 #ifdef PSP_MPROTECT
     // size of padding + size of fields above
     // ==
     // page_size. this invariant is checked in
     // the constructor if
     // mprotect is enabled
-    char m_padding[3820];
+    char m_padding[3804];
 #endif
 };
 
@@ -27,12 +27,28 @@ public:
     t_tscalar get_interned_tscalar(const t_tscalar& s);
     t_uindex size() const;
 
+    /**
+     * @brief Bytes held by the interned strings and their lookup map.
+     *
+     * @return t_uindex
+     */
+    t_uindex get_memory_usage() const;
+
 private:
     t_mapping m_mapping;
+    t_uindex m_nbytes;
 };
 
 PERSPECTIVE_EXPORT const char* get_interned_cstr(const char* s);
 PERSPECTIVE_EXPORT t_tscalar get_interned_tscalar(const char* s);
 PERSPECTIVE_EXPORT t_tscalar get_interned_tscalar(const t_tscalar& s);
 
+/**
+ * @brief Bytes held by the process-wide string interner, which is shared by
+ * every table.
+ *
+ * @return t_uindex
+ */
+PERSPECTIVE_EXPORT t_uindex get_interned_memory_usage();
+
 } // end namespace perspective
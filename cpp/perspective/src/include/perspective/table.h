@@ -16,9 +16,29 @@
 #include <perspective/pool.h>
 #include <perspective/computed.h>
 #include <perspective/data_table.h>
+#include <perspective/path.h>
+#include <map>
+#include <mutex>
 
 namespace perspective {
 
+/**
+ * @brief A flat context registered with the gnode on behalf of every `View`
+ * whose `t_view_config` produces the same context key. Pivoted contexts are
+ * never shared, as each view has its own expansion state. The context is
+ * unregistered when the last of those views is destroyed.
+ */
+struct PERSPECTIVE_EXPORT t_shared_context {
+    t_shared_context(const std::string& key, const std::string& name, std::shared_ptr<void> ctx);
+
+    std::string m_key;
+
+    // The name the context is registered under in the gnode
+    std::string m_name;
+    std::shared_ptr<void> m_ctx;
+    t_uindex m_refcount;
+};
+
 /**
  * @brief the `Table` class encapsulates `t_data_table`, `t_pool` and `t_gnode`, offering
  * a unified public API for consumption by binding languages.
@@ -52,7 +72,8 @@ public:
      * @brief Register the given `t_data_table` with the underlying pool and gnode, thus
      * allowing operations on it.
      *
-     * @param data_table
+     * @param data_table - may be left empty, as an empty input port takes its
+     * columns instead of copying them.
      * @param row_count
      * @param op
      */
@@ -65,6 +86,16 @@ public:
      */
     t_uindex size() const;
 
+    /**
+     * @brief The bytes held by this table's `t_gnode` by category:
+     * `master_table`, `mapping`, `input_ports` and `transitional_tables`.
+     * Contexts are reported by each `View`, and strings interned across
+     * all tables by `get_interned_memory_usage`.
+     *
+     * @return t_memory_usage
+     */
+    t_memory_usage get_memory_usage() const;
+
     /**
      * @brief The schema of the underlying `t_data_table`, which contains the
      * `psp_pkey`, `psp_op` and `psp_pkey` meta columns, and none of the
@@ -151,6 +182,56 @@ public:
      */
     void calculate_offset(std::uint32_t row_count);
 
+    /**
+     * @brief Return the context registered under `key`, adding a reference
+     * to it, or nullptr if no view has registered a context for the key.
+     *
+     * @tparam CTX_T
+     * @param key - from `t_view_config::get_context_key()`
+     * @return std::shared_ptr<CTX_T>
+     */
+    template <typename CTX_T>
+    std::shared_ptr<CTX_T>
+    acquire_context(const std::string& key) {
+        return std::static_pointer_cast<CTX_T>(_acquire_context(key));
+    }
+
+    /**
+     * @brief Make a newly registered context available to later views with
+     * the same `key`. The caller holds the first reference.
+     *
+     * @param key
+     * @param name - the name the context was registered under in the gnode.
+     * @param ctx
+     */
+    void share_context(const std::string& key, const std::string& name, std::shared_ptr<void> ctx);
+
+    /**
+     * @brief Return the shared context entry for `ctx`, or nullptr if `ctx`
+     * was not shared through this table.
+     *
+     * @param ctx
+     * @return std::shared_ptr<t_shared_context>
+     */
+    std::shared_ptr<t_shared_context> get_shared_context(const void* ctx) const;
+
+    /**
+     * @brief Drop a reference to `shared`, returning true when it was the last
+     * one and the context should be unregistered from the gnode.
+     *
+     * @param shared
+     * @return bool
+     */
+    bool release_context(std::shared_ptr<t_shared_context> shared);
+
+    /**
+     * @brief The number of views currently holding `shared`.
+     *
+     * @param shared
+     * @return t_uindex
+     */
+    t_uindex get_share_count(std::shared_ptr<t_shared_context> shared) const;
+
     // Getters
     t_uindex get_id() const;
     std::shared_ptr<t_pool> get_pool() const;
@@ -181,6 +262,8 @@ private:
      */
     void process_op_column(t_data_table& data_table, const t_op op);
 
+    std::shared_ptr<void> _acquire_context(const std::string& key);
+
     bool m_init;
     t_uindex m_id;
     std::shared_ptr<t_pool> m_pool;
@@ -208,6 +291,13 @@ private:
      */
     const std::string m_index;
     bool m_gnode_set;
+
+    /**
+     * @brief Contexts shared between views, keyed by context key.
+     *
+     */
+    std::map<std::string, std::shared_ptr<t_shared_context>> m_shared_contexts;
+    mutable std::mutex m_shared_contexts_mtx;
 };
 
 } // namespace perspective
\ No newline at end of file
@@ -14,9 +14,12 @@
 #include <perspective/exports.h>
 #include <boost/functional/hash.hpp>
 #include <chrono>
+#include <ctime>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <string>
+#include <vector>
 #ifndef WIN32
 #include <sys/time.h>
 #endif
@@ -122,6 +125,86 @@ private:
 
 t_tdelta operator-(const t_time& a, const t_time& b);
 
+/**
+ * @brief The process timezone, resolved once into a table of UTC offset
+ * transitions, so that UTC timestamps can be converted to local calendar
+ * fields with pure arithmetic instead of one `std::localtime` call per
+ * value. Unlike `std::localtime`, conversion is thread-safe and takes no
+ * locks.
+ *
+ * `TZ` is read when the table is first needed and again only on
+ * `refresh()`, which each new `Table` calls so that
+ * `os.environ["TZ"] = ...; time.tzset()` in Python applies to the tables
+ * created after it. Timestamps outside the table's range, 1970 - 2040,
+ * fall back to `localtime_r`.
+ */
+class PERSPECTIVE_EXPORT t_local_timezone {
+public:
+    PSP_NON_COPYABLE(t_local_timezone);
+
+    /**
+     * @brief The table for the current value of `TZ`, which stays valid for
+     * the lifetime of the process.
+     *
+     * @return const t_local_timezone&
+     */
+    static const t_local_timezone& get();
+
+    /**
+     * @brief Re-read `TZ` and `tzset`, building the table for the new value
+     * if it has not been seen before. Cheap when `TZ` is unchanged.
+     */
+    static void refresh();
+
+    /**
+     * @brief Fill `out` with the local calendar fields of `secs`, in seconds
+     * since the epoch, as `localtime_r` would.
+     *
+     * @param secs
+     * @param out
+     * @return bool - false if `secs` cannot be represented
+     */
+    bool to_tm(std::int64_t secs, std::tm& out) const;
+
+    /**
+     * @brief The offset from UTC in seconds of local time at `secs`.
+     *
+     * @param secs
+     * @return std::int64_t
+     */
+    std::int64_t get_offset(std::int64_t secs) const;
+
+private:
+    struct t_transition {
+        std::int64_t m_utc;
+        std::int32_t m_offset;
+        std::int32_t m_isdst;
+    };
+
+    explicit t_local_timezone(const char* tz);
+
+    bool matches(const char* tz) const;
+    const t_transition* find(std::int64_t secs) const;
+
+    bool m_has_tz;
+    std::string m_tz;
+
+    // Sorted by `m_utc`, the first covering the start of the range
+    std::vector<t_transition> m_transitions;
+    std::int64_t m_begin;
+    std::int64_t m_end;
+};
+
+/**
+ * @brief Convert `secs` since the epoch to local calendar fields through
+ * `t_local_timezone`; a thread-safe replacement for `std::localtime`.
+ *
+ * @param secs
+ * @param out
+ * @return bool
+ */
+PERSPECTIVE_EXPORT bool local_tm(std::int64_t secs, std::tm& out);
+
 inline size_t
 hash_value(const t_time& t) {
     boost::hash<std::int64_t> hasher;
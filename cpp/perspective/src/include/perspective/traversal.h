@@ -52,10 +52,28 @@ public:
 
     t_uindex size() const;
 
+    /**
+     * @brief Bytes held by the nodes of this traversal.
+     *
+     * @return t_uindex
+     */
+    t_uindex get_memory_usage() const;
+
     t_depth get_depth(t_index idx) const;
 
     t_index get_traversal_index(t_index idx);
 
+    /**
+     * @brief The traversal index of the last tree node in `ancestry`, a path
+     * of tree indices starting at the root as returned by
+     * `t_stree::get_ancestry`, or `INVALID_INDEX` if the node is not
+     * visible. Only the siblings along the path are visited.
+     *
+     * @param ancestry
+     * @return t_index
+     */
+    t_index get_traversal_index(const std::vector<t_uindex>& ancestry) const;
+
     std::vector<t_vdnode> get_view_nodes(t_index bidx, t_index eidx) const;
 
     void get_expanded_span(const std::vector<t_uindex>& in_ptidxes,
@@ -108,9 +126,21 @@ public:
     void populate_root_children(const t_stnode_vec& rchildren);
     void populate_root_children(std::shared_ptr<const t_stree> tree);
 
+    /**
+     * @brief A version which changes whenever nodes are added to, removed
+     * from or reordered in this traversal, and is unique across all
+     * traversals, so it can key caches of anything derived from the nodes.
+     *
+     * @return t_uindex
+     */
+    t_uindex get_version() const;
+
 private:
+    void set_modified();
+
     std::shared_ptr<const t_stree> m_tree;
     std::shared_ptr<std::vector<t_tvnode>> m_nodes;
+    t_uindex m_version;
 };
 
 /**
@@ -223,6 +253,7 @@ t_traversal::sort_by(const t_config& config, const std::vector<t_sortspec>& sort
     }
 
     std::swap(*m_nodes, new_nodes);
+    set_modified();
 }
 
 } // end namespace perspective
@@ -56,6 +56,10 @@ ctx_expand_path(CONTEXT_T& ctx, t_header header, std::shared_ptr<t_stree> tree,
 
         t_index tvidx = traversal->tree_index_lookup(root, bidx);
 
+        if (tvidx < 0) {
+            break;
+        }
+
         bidx = tvidx;
         ctx.open(header, tvidx);
     }
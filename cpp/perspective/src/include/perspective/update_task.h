@@ -11,6 +11,7 @@
 #include <perspective/first.h>
 #include <perspective/base.h>
 #include <perspective/exports.h>
+#include <vector>
 
 namespace perspective {
 class t_pool;
@@ -18,9 +19,29 @@ class t_pool;
 class PERSPECTIVE_EXPORT t_update_task {
 public:
     t_update_task(t_pool& pool);
-    virtual void run();
+    /**
+     * @brief Process every input port of every gnode in the pool.
+     *
+     * If `updated_ports` is null, userspace is notified as each port is
+     * processed. Otherwise, the id of each port that should notify
+     * userspace is written into `updated_ports`, so the caller can notify
+     * after releasing the pool lock. Unless `flush` is set, ports whose
+     * batch is not yet due under their gnode's `t_batch_policy` are skipped.
+     * 
+     * @param updated_ports 
+     * @param flush 
+     * @return t_uindex milliseconds until the earliest skipped batch is due,
+     * or 0 if no batch was skipped.
+     */
+    virtual t_uindex run(std::vector<t_uindex>* updated_ports = nullptr, bool flush = true);
 
 private:
+    /**
+     * @brief If metrics are enabled, record the size of each gnode and the
+     * resident memory of the process as gauges.
+     */
+    void record_memory();
+
     t_pool& m_pool;
 };
 
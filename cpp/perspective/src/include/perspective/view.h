@@ -216,6 +216,26 @@ public:
      */
     std::shared_ptr<t_data_slice<CTX_T>> get_row_delta() const;
 
+    /**
+     * @brief Returns the row delta serialized to Arrow. The delta is
+     * serialized at most once per pool epoch; the cache belongs to this view
+     * alone, even when its context is shared.
+     *
+     * @return std::shared_ptr<std::string>
+     */
+    std::shared_ptr<std::string> get_row_delta_arrow() const;
+
+    /**
+     * @brief The bytes held by this view's context by category, i.e.
+     * `tree`, `aggregates`, `traversal`, `deltas` and `symtable`, and by
+     * its cached row delta as `serialization`. Views sharing a context are
+     * each attributed an equal share of it, so that summing over all views
+     * counts the context once.
+     *
+     * @return t_memory_usage
+     */
+    t_memory_usage get_memory_usage() const;
+
     // Getters
     std::shared_ptr<CTX_T> get_context() const;
     std::vector<std::string> get_row_pivots() const;
@@ -253,6 +273,12 @@ private:
 
     void _find_hidden_sort(const std::vector<t_sortspec>& sort);
 
+    /**
+     * @brief Rebuild the cached column headers if the column axis of the
+     * context has changed since they were computed.
+     */
+    void _update_column_cache() const;
+
     std::shared_ptr<Table> m_table;
     std::shared_ptr<CTX_T> m_ctx;
     std::string m_name;
@@ -271,5 +297,19 @@ private:
     t_uindex m_col_offset;
 
     std::shared_ptr<t_view_config> m_view_config;
+
+    // Set when `m_ctx` may be shared with other views of the same config
+    std::shared_ptr<t_shared_context> m_shared_context;
+
+    // The serialized row delta and the pool epoch it was computed in
+    mutable t_uindex m_row_delta_epoch;
+    mutable std::shared_ptr<std::string> m_row_delta;
+
+    // The column headers of a column-pivoted view with `__ROW_PATH__` first,
+    // the context column of each header if sorted, and the version of the
+    // context's column axis they were computed for.
+    mutable t_uindex m_column_cache_version;
+    mutable std::shared_ptr<const std::vector<std::vector<t_tscalar>>> m_column_cache_names;
+    mutable std::vector<t_uindex> m_column_cache_indices;
 };
 } // end namespace perspective
\ No newline at end of file
@@ -104,6 +104,17 @@ public:
     std::int32_t get_row_pivot_depth() const;
     std::int32_t get_column_pivot_depth() const;
 
+    /**
+     * @brief Return a canonical string key for everything that determines
+     * the contents of the engine context: pivots, aggregates, columns,
+     * filters, sorts and computed columns. Flat views whose keys are equal
+     * share a single context. Filter values are written exactly, so that
+     * e.g. floats which differ past their printed precision do not collide.
+     *
+     * @return std::string
+     */
+    std::string get_context_key() const;
+
 private:
     bool m_init;
 
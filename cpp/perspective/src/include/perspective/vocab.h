@@ -17,6 +17,7 @@
 #include <functional>
 #include <limits>
 #include <cmath>
+#include <perspective/memory_usage.h>
 #include <tsl/hopscotch_map.h>
 
 namespace perspective {
@@ -34,6 +35,13 @@ public:
     std::shared_ptr<t_lstore> get_vlendata();
     std::shared_ptr<t_lstore> get_extents();
     t_uindex get_vlenidx() const;
+
+    /**
+     * @brief Bytes held by the string data, extents and the lookup map of
+     * this vocabulary.
+     *
+     * @return t_uindex
+     */
     t_uindex nbytes() const;
     void verify() const;
     void verify_size() const;
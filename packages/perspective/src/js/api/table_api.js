@@ -103,6 +103,8 @@ table.prototype.is_valid_filter = async_queue("is_valid_filter", "table_method")
 
 table.prototype.size = async_queue("size", "table_method");
 
+table.prototype.memory_usage = async_queue("memory_usage", "table_method");
+
 table.prototype.columns = async_queue("columns", "table_method");
 
 table.prototype.clear = async_queue("clear", "table_method");
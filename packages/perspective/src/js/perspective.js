@@ -82,13 +82,16 @@ export default function(Module) {
      * @param {boolean} is_update - true if we are updating an already-created
      * table
      * @param {boolean} is_arrow - true if the dataset is in the Arrow format
+     * @param {boolean} is_csv - true if the dataset is a CSV string
+     * @param {boolean} is_json - true if the dataset is a JSON or
+     * newline-delimited JSON string
      * @param {Number} port_id - an integer indicating the internal `t_port`
      * which should receive this update.
      *
      * @private
      * @returns {Table} An `std::shared_ptr<Table>` to a `Table` inside C++.
      */
-    function make_table(accessor, _Table, index, limit, op, is_update, is_arrow, is_csv, port_id) {
+    function make_table(accessor, _Table, index, limit, op, is_update, is_arrow, is_csv, is_json, port_id) {
         // C++ constructor cannot take null values - use default values if
         // index or limit are null.
         if (!index) {
@@ -99,7 +102,7 @@ export default function(Module) {
             limit = 4294967295;
         }
 
-        _Table = __MODULE__.make_table(_Table, accessor, limit, index, op, is_update, is_arrow, is_csv, port_id);
+        _Table = __MODULE__.make_table(_Table, accessor, limit, index, op, is_update, is_arrow, is_csv, is_json, port_id);
 
         const pool = _Table.get_pool();
         const table_id = _Table.get_id();
@@ -113,6 +116,18 @@ export default function(Module) {
         return _Table;
     }
 
+    /**
+     * Whether a string dataset is JSON or newline-delimited JSON rather than
+     * CSV, in which case it is parsed directly by the C++ JSON loader.
+     *
+     * @private
+     * @param {String} data
+     * @returns {boolean}
+     */
+    function is_json_string(data) {
+        return /^\s*[[{]/.test(data);
+    }
+
     /***************************************************************************
      *
      * View
@@ -726,6 +741,21 @@ export default function(Module) {
         return this._View.num_rows();
     };
 
+    /**
+     * The bytes allocated by this {@link module:perspective~view}'s context,
+     * by category, i.e. "tree", "aggregates", "traversal", "deltas" and
+     * "symtable". Views sharing a context are each attributed an equal
+     * share of it.
+     *
+     * @async
+     *
+     * @returns {Promise<Object>} An Object of category names to bytes.
+     */
+    view.prototype.memory_usage = function() {
+        _call_process(this.table.get_id());
+        return extract_map(this._View.get_memory_usage());
+    };
+
     /**
      * The number of aggregated columns in this {@link view}.  This is affected
      * by the "column_pivots" configuration parameter supplied to this
@@ -1200,6 +1230,22 @@ export default function(Module) {
         return this._Table.size();
     };
 
+    /**
+     * The bytes allocated by this {@link module:perspective~table}, by
+     * category: "master_table", "mapping", "input_ports" and
+     * "transitional_tables". Memory held by each
+     * {@link module:perspective~view} is reported by its own
+     * `memory_usage()`, and is not included.
+     *
+     * @async
+     *
+     * @returns {Promise<Object>} An Object of category names to bytes.
+     */
+    table.prototype.memory_usage = function() {
+        _call_process(this._Table.get_id());
+        return extract_map(this._Table.get_memory_usage());
+    };
+
     /**
      * The schema of this {@link module:perspective~table}.  A schema is an
      * Object whose keys are the columns of this
@@ -1481,12 +1527,16 @@ export default function(Module) {
         let types = schema.types();
         let is_arrow = false;
         let is_csv = false;
+        let is_json = false;
 
         pdata = accessor;
 
         if (data instanceof ArrayBuffer) {
             pdata = new Uint8Array(data);
             is_arrow = true;
+        } else if (typeof data === "string" && is_json_string(data)) {
+            is_json = true;
+            pdata = data;
         } else if (typeof data === "string") {
             if (data[0] === ",") {
                 data = "_" + data;
@@ -1504,7 +1554,7 @@ export default function(Module) {
             }
         }
 
-        if (!is_arrow) {
+        if (!is_arrow && !is_json) {
             if (pdata.row_count === 0) {
                 console.warn("table.update called with no data - ignoring");
                 return;
@@ -1528,7 +1578,7 @@ export default function(Module) {
             const op = __MODULE__.t_op.OP_INSERT;
             // update the Table in C++, but don't keep the returned C++ Table
             // reference as it is identical
-            make_table(pdata, this._Table, this.index, this.limit, op, true, is_arrow, is_csv, options.port_id);
+            make_table(pdata, this._Table, this.index, this.limit, op, true, is_arrow, is_csv, is_json, options.port_id);
             this.initialized = true;
         } catch (e) {
             console.error(`Update failed: ${e}`);
@@ -1575,7 +1625,7 @@ export default function(Module) {
             const op = __MODULE__.t_op.OP_DELETE;
             // update the Table in C++, but don't keep the returned Table
             // reference as it is identical
-            make_table(pdata, this._Table, this.index, this.limit, op, false, is_arrow, false, options.port_id);
+            make_table(pdata, this._Table, this.index, this.limit, op, false, is_arrow, false, false, options.port_id);
             this.initialized = true;
         } catch (e) {
             console.error(`Remove failed`, e);
@@ -1701,10 +1751,14 @@ export default function(Module) {
             let is_arrow = false;
             let overridden_types = {};
             let is_csv = false;
+            let is_json = false;
 
             if (data instanceof ArrayBuffer || (typeof Buffer !== "undefined" && data instanceof Buffer)) {
                 data_accessor = new Uint8Array(data);
                 is_arrow = true;
+            } else if (typeof data === "string" && is_json_string(data)) {
+                is_json = true;
+                data_accessor = data;
             } else if (typeof data === "string") {
                 if (data[0] === ",") {
                     data = "_" + data;
@@ -1731,7 +1785,7 @@ export default function(Module) {
                 // and limit, so `make_table` will convert null to default
                 // values of "" for index and 4294967295 for limit. Tables
                 // must be created on port 0.
-                _Table = make_table(data_accessor, undefined, options.index, options.limit, op, false, is_arrow, is_csv, 0);
+                _Table = make_table(data_accessor, undefined, options.index, options.limit, op, false, is_arrow, is_csv, is_json, 0);
 
                 // Pass through user-provided values or `null` to the
                 // Javascript Table constructor.
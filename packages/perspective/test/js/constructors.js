@@ -677,6 +677,39 @@ module.exports = perspective => {
         });
     });
 
+    describe("JSON parsing", function() {
+        it("Loads a JSON string of records", async function() {
+            let table = perspective.table(JSON.stringify(data));
+            let view = table.view();
+            let result = await view.to_json();
+            expect(result).toEqual(data);
+            view.delete();
+            table.delete();
+        });
+
+        it("Loads a JSON string of columns", async function() {
+            let table = perspective.table(JSON.stringify({x: [1, 2], y: ["a", "b"]}));
+            let view = table.view();
+            let result = await view.to_columns();
+            expect(result).toEqual({x: [1, 2], y: ["a", "b"]});
+            view.delete();
+            table.delete();
+        });
+
+        it("Updates an indexed table from newline-delimited JSON", async function() {
+            let table = perspective.table({x: "integer", y: "string"}, {index: "x"});
+            table.update('{"x": 1, "y": "a"}\n{"x": 2, "y": "b"}\n{"x": 1, "y": "c"}');
+            let view = table.view();
+            let result = await view.to_json();
+            expect(result).toEqual([
+                {x: 1, y: "c"},
+                {x: 2, y: "b"}
+            ]);
+            view.delete();
+            table.delete();
+        });
+    });
+
     describe("Constructors", function() {
         it("JSON constructor", async function() {
             var table = perspective.table(data);
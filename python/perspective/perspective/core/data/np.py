@@ -30,8 +30,6 @@ def make_null_mask(array):
     Args:
         array (:obj:`numpy.array`)
     """
-    mask = []
-
     is_object_or_string_dtype = np.issubdtype(array.dtype, np.str_) or np.issubdtype(
         array.dtype, np.object_
     )
@@ -45,19 +43,16 @@ def make_null_mask(array):
         array.dtype, np.timedelta64
     )
 
-    for i, item in enumerate(array):
-        invalid = item is None
-
-        if not is_object_or_string_dtype:
-            if is_datetime_dtype:
-                invalid = invalid or str(item) == "NaT"
-            else:
-                invalid = invalid or np.isnan(item)
-
-        if invalid:
-            mask.append(i)
+    if is_object_or_string_dtype:
+        # `None` can only be found by identity
+        return [i for i, item in enumerate(array) if item is None]
+    elif is_datetime_dtype:
+        return np.flatnonzero(np.isnat(array))
+    elif array.dtype.kind in "fc":
+        return np.flatnonzero(np.isnan(array))
 
-    return mask
+    # int, uint and bool arrays cannot hold null values
+    return []
 
 
 def deconstruct_numpy(array, mask=None):
@@ -73,6 +73,7 @@ PYBIND11_MODULE(libbinding, m)
         .def(py::init<std::shared_ptr<t_pool>, std::vector<std::string>, std::vector<t_dtype>,
         std::uint32_t, std::string>())
         .def("size", &Table::size)
+        .def("get_memory_usage", &Table::get_memory_usage)
         .def("get_schema", &Table::get_schema)
         .def("unregister_gnode", &Table::unregister_gnode)
         .def("reset_gnode", &Table::reset_gnode)
@@ -107,6 +108,7 @@ PYBIND11_MODULE(libbinding, m)
         .def("get_filter", &View<t_ctxunit>::get_filter)
         .def("get_sort", &View<t_ctxunit>::get_sort)
         .def("get_step_delta", &View<t_ctxunit>::get_step_delta)
+        .def("get_memory_usage", &View<t_ctxunit>::get_memory_usage)
         .def("get_column_dtype", &View<t_ctxunit>::get_column_dtype)
         .def("is_column_only", &View<t_ctxunit>::is_column_only);
 
@@ -130,6 +132,7 @@ PYBIND11_MODULE(libbinding, m)
         .def("get_filter", &View<t_ctx0>::get_filter)
         .def("get_sort", &View<t_ctx0>::get_sort)
         .def("get_step_delta", &View<t_ctx0>::get_step_delta)
+        .def("get_memory_usage", &View<t_ctx0>::get_memory_usage)
         .def("get_column_dtype", &View<t_ctx0>::get_column_dtype)
         .def("is_column_only", &View<t_ctx0>::is_column_only);
 
@@ -156,6 +159,7 @@ PYBIND11_MODULE(libbinding, m)
         .def("get_filter", &View<t_ctx1>::get_filter)
         .def("get_sort", &View<t_ctx1>::get_sort)
         .def("get_step_delta", &View<t_ctx1>::get_step_delta)
+        .def("get_memory_usage", &View<t_ctx1>::get_memory_usage)
         .def("get_column_dtype", &View<t_ctx1>::get_column_dtype)
         .def("is_column_only", &View<t_ctx1>::is_column_only);
 
@@ -183,6 +187,7 @@ PYBIND11_MODULE(libbinding, m)
         .def("get_sort", &View<t_ctx2>::get_sort)
         .def("get_row_path", &View<t_ctx2>::get_row_path)
         .def("get_step_delta", &View<t_ctx2>::get_step_delta)
+        .def("get_memory_usage", &View<t_ctx2>::get_memory_usage)
         .def("get_column_dtype", &View<t_ctx2>::get_column_dtype)
         .def("is_column_only", &View<t_ctx2>::is_column_only);
 
@@ -225,7 +230,8 @@ PYBIND11_MODULE(libbinding, m)
      * t_gnode
      */
     py::class_<t_gnode, std::shared_ptr<t_gnode>>(m, "t_gnode")
-        .def("get_id", reinterpret_cast<t_uindex (t_gnode::*)() const>(&t_gnode::get_id));
+        .def("get_id", reinterpret_cast<t_uindex (t_gnode::*)() const>(&t_gnode::get_id))
+        .def("get_registered_contexts", &t_gnode::get_registered_contexts);
 
     /******************************************************************************
      *
@@ -286,11 +292,59 @@ PYBIND11_MODULE(libbinding, m)
      *
      * t_pool
      */
+    py::class_<t_batch_policy>(m, "t_batch_policy")
+        .def(py::init<>())
+        .def_readwrite("max_latency_ms", &t_batch_policy::m_max_latency_ms)
+        .def_readwrite("max_rows", &t_batch_policy::m_max_rows)
+        .def_readwrite("max_bytes", &t_batch_policy::m_max_bytes);
+
+    py::class_<t_batch_stats>(m, "t_batch_stats")
+        .def_readonly("num_batches", &t_batch_stats::m_num_batches)
+        .def_readonly("num_rows", &t_batch_stats::m_num_rows)
+        .def_readonly("last_rows", &t_batch_stats::m_last_rows)
+        .def_readonly("max_rows", &t_batch_stats::m_max_rows)
+        .def_readonly("last_latency_ms", &t_batch_stats::m_last_latency_ms)
+        .def_readonly("max_latency_ms", &t_batch_stats::m_max_latency_ms);
+
+    py::class_<t_shrink_policy>(m, "t_shrink_policy")
+        .def(py::init<>())
+        .def_readwrite("min_updates", &t_shrink_policy::m_min_updates)
+        .def_readwrite("ratio", &t_shrink_policy::m_ratio)
+        .def_readwrite("min_rows", &t_shrink_policy::m_min_rows)
+        .def_readwrite("shrink_master", &t_shrink_policy::m_shrink_master);
+
+    py::class_<t_metric_histogram>(m, "t_metric_histogram")
+        .def_readonly("count", &t_metric_histogram::m_count)
+        .def_readonly("sum", &t_metric_histogram::m_sum)
+        .def_readonly("min", &t_metric_histogram::m_min)
+        .def_readonly("max", &t_metric_histogram::m_max)
+        .def("mean", &t_metric_histogram::mean)
+        .def("percentile", &t_metric_histogram::percentile);
+
+    py::class_<t_metrics, std::shared_ptr<t_metrics>>(m, "t_metrics")
+        .def("set_enabled", &t_metrics::set_enabled)
+        .def("is_enabled", &t_metrics::is_enabled)
+        .def("set_tracing", &t_metrics::set_tracing,
+            py::arg("enabled"), py::arg("capacity") = PSP_METRICS_TRACE_CAPACITY)
+        .def("is_tracing", &t_metrics::is_tracing)
+        .def("get_counters", &t_metrics::get_counters)
+        .def("get_histograms", &t_metrics::get_histograms)
+        .def("to_json", &t_metrics::to_json)
+        .def("to_chrome_trace", &t_metrics::to_chrome_trace)
+        .def("reset", &t_metrics::reset);
+
     py::class_<t_pool, std::shared_ptr<t_pool>>(m, "t_pool")
         .def(py::init<>())
         .def("set_update_delegate", &t_pool::set_update_delegate)
         .def("unregister_gnode", &t_pool::unregister_gnode)
         .def("set_event_loop", &t_pool::set_event_loop)
+        .def("start_engine", &t_pool::start_engine)
+        .def("stop_engine", &t_pool::stop_engine)
+        .def("is_engine_running", &t_pool::is_engine_running)
+        .def("set_batch_policy", &t_pool::set_batch_policy)
+        .def("get_batch_stats", &t_pool::get_batch_stats)
+        .def("set_shrink_policy", &t_pool::set_shrink_policy)
+        .def("get_metrics", &t_pool::get_metrics)
         .def("_process", &t_pool::_process);
 
     /******************************************************************************
@@ -426,6 +480,7 @@ PYBIND11_MODULE(libbinding, m)
     m.def("make_computations", &make_computations);
     m.def("scalar_to_py", &scalar_to_py);
     m.def("_set_nthreads", &_set_nthreads);
+    m.def("get_interned_memory_usage", &get_interned_memory_usage);
 }
 
 #endif
@@ -25,6 +25,16 @@ namespace binding {
 template <>
 void set_column_nth(std::shared_ptr<t_column> col, t_uindex idx, t_val value);
 
+/**
+ * Fill a DTYPE_DATE or DTYPE_TIME column. Date strings in the formats
+ * recognized by `t_date_parser::parse_extended` are parsed together without
+ * the GIL, while other values and strings go through `accessor.marshal`.
+ *
+ * If `check_has_column` is set, rows without the column are skipped.
+ */
+void _fill_col_datetime(t_data_accessor accessor, std::shared_ptr<t_column> col, const std::string& name,
+    std::int32_t cidx, t_dtype type, bool is_update, bool check_has_column);
+
 /******************************************************************************
  *
  * Fill tables with data
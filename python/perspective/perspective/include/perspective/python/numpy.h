@@ -35,6 +35,28 @@ namespace numpy {
         FILL_FAIL
     };
 
+    /**
+     * A column whose numpy array has a numeric or datetime dtype, and can be written into the column without calling
+     * into Python. These are collected while reading arrays from the accessor, then filled in parallel.
+     */
+    struct t_bulk_fill {
+        std::shared_ptr<t_column> m_col;
+        std::string m_name;
+        std::uint32_t m_cidx;
+        t_dtype m_np_dtype;
+        t_dtype m_type;
+
+        // Whether values are converted from `m_np_dtype` to `m_type` rather than copied.
+        bool m_cast;
+
+        // False if the fill must be retried through `fill_numeric_iter`, i.e. to promote the column.
+        bool m_filled;
+
+        // Hold references to the array and its null mask while their buffers are read.
+        py::array m_array;
+        py::array_t<std::uint64_t> m_mask;
+    };
+
     /**
      * NumpyLoader fast-tracks the loading of Numpy arrays into Perspective, utilizing memcpy whenever possible.
      */
@@ -88,6 +110,20 @@ namespace numpy {
              */
             static const std::vector<std::string> DATE_UNITS;
         private:
+            /**
+             * Fill a column as `fill_column` does, but defer numeric and datetime arrays to `bulk_fills` so that
+             * they can be written in parallel by `fill_bulk`.
+             */
+            void fill_column(t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name, t_dtype type, std::uint32_t cidx, bool is_update, std::vector<t_bulk_fill>& bulk_fills);
+
+            /**
+             * Write each of `bulk_fills` into its column, in parallel across columns, then fill any that could not be
+             * written without calling into Python through iteration.
+             */
+            void fill_bulk(t_data_table& tbl, std::vector<t_bulk_fill>& bulk_fills, bool is_update);
+
+            void fill_column_bulk(t_bulk_fill& fill, bool is_update);
+
             /**
              * When memory cannot be copied for dtype=object arrays, for example), fill the column through iteration.
              */
@@ -137,6 +173,15 @@ namespace numpy {
              */
             t_fill_status try_copy_array(const py::array& src, std::shared_ptr<t_column> dest, t_dtype np_dtype, t_dtype type, const std::uint64_t offset);
 
+            /**
+             * Convert the values of a numpy array of `np_dtype` into a column of `type`, for the numeric mismatches
+             * listed in `fill_column`. NaNs are written as null.
+             * 
+             * Returns `FILL_FAIL` without writing to `dest` if the conversion is not supported, or if a value would
+             * promote the column, which only `fill_object_iter` can do.
+             */
+            t_fill_status try_cast_array(const void* src, std::shared_ptr<t_column> dest, t_dtype np_dtype, t_dtype type, bool is_update);
+
             void fill_validity_map(std::shared_ptr<t_column> col, std::uint64_t* mask_ptr, std::size_t mask_size, bool is_update);
 
             // Return the column names from the Python data accessor
@@ -164,6 +209,20 @@ namespace numpy {
     template <typename T>
     void copy_array_helper(const void* src, std::shared_ptr<t_column> dest, const std::uint64_t offset);
 
+    /**
+     * Convert the data of a numpy array of `SRC_T` into a `t_column` of `DST_T`, writing NaNs as null.
+     * 
+     * If `check_range` is set and any value is out of the range of `DST_T`, return false without writing to `dest`.
+     */
+    template <typename SRC_T, typename DST_T>
+    bool cast_array_helper(const void* src, std::shared_ptr<t_column> dest, bool is_update, bool check_range);
+
+    /**
+     * Copy the data of a float64 array of millisecond timestamps into a `DTYPE_TIME` column. `NaT` values are written
+     * as 0, and are left to the null mask.
+     */
+    void copy_datetime_helper(const void* src, std::shared_ptr<t_column> dest);
+
 } // namespace numpy
 } // numpy perspective
 #endif
\ No newline at end of file
@@ -41,13 +41,26 @@ class PerspectiveManager(_PerspectiveManagerInternal):
         clean up associated resources.
     """
 
-    def __init__(self, lock=False):
+    def __init__(self, lock=False, max_queue_depth=None, queue_policy="conflate"):
         """Create a new ``PerspectiveManager`` instance.
 
         Keyword Args:
             lock (:obj:`bool`): [description]. Defaults to False.
+            max_queue_depth (:obj:`int`): the maximum number of `on_update`
+                notifications pending for a single client, i.e. one that
+                reads from its websocket slower than the tables update.
+                Defaults to `None`, which does not limit the queue.
+            queue_policy (:obj:`str`): how pending notifications are shed
+                for a slow client - `conflate` replaces a pending notification
+                for the same view with the newest one, and drops the oldest
+                when the queue is full, `drop_oldest` only drops the oldest,
+                and `drop_newest` drops new notifications. A dropped `row`
+                mode notification is replaced by one flagged `resync`,
+                without a delta. Defaults to `conflate`.
         """
-        super(PerspectiveManager, self).__init__(lock=lock)
+        super(PerspectiveManager, self).__init__(
+            lock=lock, max_queue_depth=max_queue_depth, queue_policy=queue_policy
+        )
         self._loop_callback = None
 
     def lock(self):
@@ -106,6 +119,20 @@ class PerspectiveManager(_PerspectiveManagerInternal):
     def new_session(self):
         return PerspectiveSession(self)
 
+    def get_queue_stats(self):
+        """Return the depth metrics of the outbound queue of each session
+        that uses one, such as those created by
+        :obj:`~perspective.PerspectiveTornadoHandler`, keyed by the session's
+        `client_id`.
+
+        Each value is a dictionary with the current `depth` and
+        `update_depth` of the queue, its `max_depth` and `high_water` depth,
+        and the number of messages `sent`, `conflated` and `dropped`.
+        """
+        return {
+            client_id: queue.stats() for client_id, queue in self._queues.items()
+        }
+
     def set_loop_callback(self, loop_callback):
         """Sets this `PerspectiveManager` to run in Async mode, defering
         `update()` application and releasing the GIL for expensive operations.
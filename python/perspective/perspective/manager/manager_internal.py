@@ -10,6 +10,8 @@ from six import string_types
 import datetime
 import logging
 import json
+import threading
+from collections import deque
 from functools import partial
 from ..core.exception import PerspectiveError
 from ..table import Table, PerspectiveCppError
@@ -31,6 +33,259 @@ class DateTimeEncoder(json.JSONEncoder):
             return super(DateTimeEncoder, self).default(obj)
 
 
+class _PerspectiveOutboundMessage(object):
+    """A message pending in a `_PerspectiveOutboundQueue`, made of one or more
+    frames that are written out together, and the frames to send in its
+    place if it carries a row delta and is dropped."""
+
+    __slots__ = ("key", "frames", "is_update", "resync")
+
+    def __init__(self, key, frames, is_update, resync=None):
+        self.key = key
+        self.frames = frames
+        self.is_update = is_update
+        self.resync = resync
+
+
+class _PerspectiveOutboundQueue(object):
+    """The messages pending delivery to a single subscriber, such as a
+    websocket connection, which its transport writes out with `pop()` as fast
+    as the subscriber reads them.
+
+    The queue is passed to the manager as the `post_callback`. Responses are
+    always delivered, in order. `on_update` notifications can be dropped so
+    that a slow subscriber only loses freshness:
+
+    - With the `conflate` policy, a pending notification for a subscription
+      is replaced by the newest one. Notifications that carry a row delta
+      cannot be merged, so they are not conflated.
+    - When more than `max_depth` notifications are pending, the oldest is
+      dropped under the `conflate` and `drop_oldest` policies. Under
+      `drop_newest`, the incoming notification is dropped instead.
+
+    A subscriber cannot apply later row deltas once one has been lost, so a
+    dropped delta notification is replaced by its `resync` notification,
+    which carries no delta and tells the subscriber to fetch the view again.
+    The resync also replaces the subscription's other pending deltas, and
+    absorbs any posted before it is sent. Resyncs are never dropped, so the
+    queue can exceed `max_depth` by at most one per subscription.
+
+    All methods are thread-safe.
+    """
+
+    POLICIES = ("conflate", "drop_oldest", "drop_newest")
+
+    def __init__(self, on_ready=None, max_depth=None, policy="conflate"):
+        """Create a new queue.
+
+        Keyword Args:
+            on_ready (:obj:`callable`): called without arguments whenever a
+                message is queued, i.e. to schedule the transport to drain
+                the queue.
+            max_depth (:obj:`int`): the maximum number of pending `on_update`
+                notifications, or `None` for no limit.
+            policy (:obj:`str`): one of `conflate`, `drop_oldest` or
+                `drop_newest`.
+        """
+        if policy not in _PerspectiveOutboundQueue.POLICIES:
+            raise PerspectiveError(
+                "Invalid queue policy `{0}` - must be one of {1}".format(
+                    policy, ", ".join(_PerspectiveOutboundQueue.POLICIES)
+                )
+            )
+
+        if max_depth is not None and max_depth < 1:
+            raise PerspectiveError("`max_depth` must be at least 1.")
+
+        self._on_ready = on_ready
+        self._max_depth = max_depth
+        self._policy = policy
+        self._lock = threading.Lock()
+
+        # Messages in the order they were queued - conflated and dropped
+        # messages stay in place with their frames set to `None`.
+        self._messages = deque()
+
+        # Pending notifications in the order they were queued, and the
+        # latest conflatable notification for each subscription.
+        self._updates = deque()
+        self._latest = {}
+
+        # The pending resync notification for each subscription.
+        self._resyncs = {}
+
+        self._depth = 0
+        self._update_depth = 0
+        self._num_discarded = 0
+        self._high_water = 0
+        self._sent = 0
+        self._conflated = 0
+        self._dropped = 0
+        self._resynced = 0
+
+    def __call__(self, data, binary=False):
+        """Queue a response, which is never conflated or dropped."""
+        with self._lock:
+            self._append(_PerspectiveOutboundMessage(None, [(data, binary)], False))
+        self._notify()
+
+    def post_update(self, key, frames, conflate=True, resync=None):
+        """Queue an `on_update` notification.
+
+        Args:
+            key (:obj:`tuple`): identifies the subscription the notification
+                belongs to.
+            frames (:obj:`list`): `(data, binary)` tuples written in order.
+
+        Keyword Args:
+            conflate (:obj:`bool`): whether the notification may replace a
+                pending notification with the same `key`.
+            resync (:obj:`list`): for a notification that carries a row
+                delta, the frames of a notification without the delta, which
+                is sent in its place if it is dropped.
+        """
+        with self._lock:
+            queued = self._post_update(key, frames, conflate, resync)
+        if queued:
+            self._notify()
+
+    def _post_update(self, key, frames, conflate, resync):
+        if key in self._resyncs:
+            # The subscriber fetches the view again when the pending resync
+            # is sent, which includes this notification.
+            self._conflated += 1
+            return False
+
+        if self._policy == "conflate" and conflate:
+            previous = self._latest.pop(key, None)
+            if previous is not None:
+                self._discard(previous)
+                self._conflated += 1
+
+        if self._max_depth is not None and self._update_depth >= self._max_depth:
+            if self._policy == "drop_newest":
+                self._dropped += 1
+                if resync is None:
+                    return False
+                self._resync(key, resync)
+                return True
+
+            self._drop_oldest_update()
+            if key in self._resyncs:
+                self._conflated += 1
+                return True
+
+        message = _PerspectiveOutboundMessage(key, frames, True, resync)
+        self._append(message)
+        self._updates.append(message)
+        self._update_depth += 1
+
+        if conflate:
+            self._latest[key] = message
+        return True
+
+    def pop(self):
+        """Remove the next message from the queue, returning its list of
+        `(data, binary)` frames, or `None` if the queue is empty."""
+        with self._lock:
+            while self._messages:
+                message = self._messages.popleft()
+                frames = message.frames
+
+                if frames is None:
+                    self._num_discarded -= 1
+                    continue
+
+                message.frames = None
+                self._depth -= 1
+                self._sent += 1
+
+                if message.is_update:
+                    self._update_depth -= 1
+                    if self._latest.get(message.key, None) is message:
+                        self._latest.pop(message.key)
+                    if self._resyncs.get(message.key, None) is message:
+                        self._resyncs.pop(message.key)
+                    self._trim_updates()
+
+                return frames
+            return None
+
+    def stats(self):
+        """Return a dictionary of queue depth metrics: the current `depth`
+        and `update_depth`, the `high_water` depth, and the number of
+        messages `sent`, `conflated`, `dropped` and `resynced` so far."""
+        with self._lock:
+            return {
+                "depth": self._depth,
+                "update_depth": self._update_depth,
+                "max_depth": self._max_depth,
+                "high_water": self._high_water,
+                "sent": self._sent,
+                "conflated": self._conflated,
+                "dropped": self._dropped,
+                "resynced": self._resynced,
+            }
+
+    def _append(self, message):
+        self._messages.append(message)
+        self._depth += 1
+        self._high_water = max(self._high_water, self._depth)
+
+    def _discard(self, message):
+        message.frames = None
+        self._depth -= 1
+        self._update_depth -= 1
+        self._num_discarded += 1
+        self._trim_updates()
+
+        # Compact once most queued messages have been discarded, so the
+        # queue stays bounded while the transport is not draining it.
+        if self._num_discarded > max(self._depth, 16):
+            self._messages = deque(m for m in self._messages if m.frames is not None)
+            self._updates = deque(m for m in self._updates if m.frames is not None)
+            self._num_discarded = 0
+
+    def _drop_oldest_update(self):
+        self._trim_updates()
+        for message in self._updates:
+            if message.frames is not None and self._resyncs.get(message.key, None) is not message:
+                break
+        else:
+            return
+
+        self._dropped += 1
+        if message.resync is not None:
+            self._resync(message.key, message.resync)
+            return
+
+        if self._latest.get(message.key, None) is message:
+            self._latest.pop(message.key)
+        self._discard(message)
+
+    def _resync(self, key, frames):
+        """Replace the pending notifications for a subscription, one of
+        which has been dropped, with the resync notification `frames`."""
+        pending = [m for m in self._updates if m.frames is not None and m.key == key]
+        for message in pending:
+            self._discard(message)
+
+        message = _PerspectiveOutboundMessage(key, frames, True)
+        self._append(message)
+        self._updates.append(message)
+        self._update_depth += 1
+        self._resyncs[key] = message
+        self._resynced += 1
+
+    def _trim_updates(self):
+        while self._updates and self._updates[0].frames is None:
+            self._updates.popleft()
+
+    def _notify(self):
+        if self._on_ready is not None:
+            self._on_ready()
+
+
 class _PerspectiveManagerInternal(object):
 
     # Commands that should be blocked from execution when the manager is in
@@ -38,13 +293,25 @@ class _PerspectiveManagerInternal(object):
     # modification.
     LOCKED_COMMANDS = ["table", "update", "remove", "replace", "clear"]
 
-    def __init__(self, lock=False):
+    def __init__(self, lock=False, max_queue_depth=None, queue_policy="conflate"):
+        if queue_policy not in _PerspectiveOutboundQueue.POLICIES:
+            raise PerspectiveError(
+                "Invalid queue policy `{0}` - must be one of {1}".format(
+                    queue_policy, ", ".join(_PerspectiveOutboundQueue.POLICIES)
+                )
+            )
+
         self._tables = {}
         self._views = {}
         self._callback_cache = _PerspectiveCallBackCache()
         self._queue_process_callback = None
         self._lock = lock
 
+        # Outbound queues created by sessions, keyed by client_id.
+        self._max_queue_depth = max_queue_depth
+        self._queue_policy = queue_policy
+        self._queues = {}
+
         # Perspective sends binary messages in two messages - a JSON
         # pre-message and the binary itself. Set up flags to handle that
         # special message flow.
@@ -326,11 +593,23 @@ class _PerspectiveManagerInternal(object):
         post_callback(binary, binary=True)
 
     def callback(self, *args, **kwargs):
-        """Return a message to the client using the `post_callback` method."""
+        """Return a message to the client using the `post_callback` method.
+
+        If `post_callback` is a `_PerspectiveOutboundQueue`, `on_update`
+        notifications are queued with `post_update`, so that they can be
+        conflated or dropped for a slow client.
+        """
         orig_msg = kwargs.get("msg")
         id = orig_msg["id"]
         method = orig_msg["method"]
         post_callback = kwargs.get("post_callback")
+        post_update = getattr(post_callback, "post_update", None)
+        frames = []
+
+        if method == "on_update" and post_update is not None:
+            # Collect the frames of the notification, which must be written
+            # together.
+            post_callback = lambda data, binary=False: frames.append((data, binary))  # noqa: E731
 
         if method == "on_update":
             # Coerce the message to be an object so it can be handled in
@@ -347,6 +626,31 @@ class _PerspectiveManagerInternal(object):
         else:
             post_callback(self._message_to_json(msg["id"], msg))
 
+        if frames:
+            # Row deltas cannot be merged, so only notifications without a
+            # delta are conflated. If a delta is dropped, the client is sent
+            # a notification flagged `resync` to fetch the view again.
+            key = (orig_msg.get("name", None), id)
+            resync = None
+            if len(frames) > 1:
+                resync_msg = self._make_message(id, {"port_id": args[0], "resync": True})
+                resync = [(self._message_to_json(id, resync_msg), False)]
+            post_update(key, frames, conflate=resync is None, resync=resync)
+
+    def _new_queue(self, client_id, on_ready=None):
+        """Create the outbound queue for a session, using the depth and
+        policy this manager was created with."""
+        queue = _PerspectiveOutboundQueue(
+            on_ready=on_ready,
+            max_depth=self._max_queue_depth,
+            policy=self._queue_policy,
+        )
+        self._queues[client_id] = queue
+        return queue
+
+    def _close_queue(self, client_id):
+        self._queues.pop(client_id, None)
+
     def clear_views(self, client_id):
         """Garbage collect views that belong to closed connections."""
         count = 0
@@ -35,12 +35,26 @@ class PerspectiveSession(object):
         """
         self.manager._process(message, post_callback, client_id=self.client_id)
 
+    def outbound_queue(self, on_ready=None):
+        """Create a queue for the messages sent to this session's client, to
+        pass to `process` as the `post_callback`. The transport writes the
+        queued messages out with `pop()`, and `on_update` notifications that
+        pile up for a slow client are conflated or dropped according to the
+        manager's `max_queue_depth` and `queue_policy`.
+
+        Args:
+            on_ready (:obj:`callable`): called without arguments whenever a
+                message is queued, possibly from another thread.
+        """
+        return self.manager._new_queue(self.client_id, on_ready)
+
     def close(self):
         """Remove the views and callbacks that were created within this session
         when the session ends.
         """
         self.manager.clear_views(self.client_id)
         self._clear_callbacks()
+        self.manager._close_queue(self.client_id)
 
     def _clear_callbacks(self):
         # remove all callbacks from the view's cache
@@ -10,6 +10,7 @@
 #ifdef PSP_ENABLE_PYTHON
 #include <perspective/base.h>
 #include <perspective/binding.h>
+#include <perspective/date_parser.h>
 #include <perspective/python/accessor.h>
 #include <perspective/python/base.h>
 #include <perspective/python/utils.h>
@@ -108,7 +109,20 @@ infer_type(t_val x, t_val date_validator) {
             t = t_dtype::DTYPE_INT64;
         }
     } else if (py::isinstance<py::str>(x) || type_string == "str") {
-        t_dtype parsed_type = date_validator.attr("format")(x).cast<t_dtype>();
+        // Common date formats are recognized natively, and only the remaining
+        // strings with date separators are handed to the `dateutil`-based
+        // validator, which treats strings without them as plain strings.
+        std::string str = x.cast<std::string>();
+        t_dtype parsed_type = t_dtype::DTYPE_STR;
+        t_parsed_datetime parsed;
+        if (t_date_parser().parse_extended(str.c_str(), str.size(), parsed)) {
+            bool is_midnight = parsed.m_hour == 0 && parsed.m_minute == 0
+                && parsed.m_second == 0 && parsed.m_millisecond == 0;
+            parsed_type = is_midnight ? t_dtype::DTYPE_DATE : t_dtype::DTYPE_TIME;
+        } else if (str.find_first_of("/. -") != std::string::npos) {
+            parsed_type = date_validator.attr("format")(x).cast<t_dtype>();
+        }
+
         if (parsed_type == t_dtype::DTYPE_DATE || parsed_type == t_dtype::DTYPE_TIME) {
             t = parsed_type;
         } else {
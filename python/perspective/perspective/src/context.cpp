@@ -25,6 +25,12 @@ template <>
 std::shared_ptr<t_ctxunit>
 make_context(std::shared_ptr<Table> table, std::shared_ptr<t_schema> schema,
     std::shared_ptr<t_view_config> view_config, const std::string& name) {
+    auto key = std::to_string(UNIT_CONTEXT) + view_config->get_context_key();
+    auto shared_ctx = table->acquire_context<t_ctxunit>(key);
+    if (shared_ctx) {
+        return shared_ctx;
+    }
+
     auto columns = view_config->get_columns();
     auto filter_op = view_config->get_filter_op();
     auto fterm = view_config->get_fterm();
@@ -42,6 +48,7 @@ make_context(std::shared_ptr<Table> table, std::shared_ptr<t_schema> schema,
         name,
         UNIT_CONTEXT,
         reinterpret_cast<std::uintptr_t>(ctx_unit.get()));
+    table->share_context(key, name, ctx_unit);
 
     return ctx_unit;
 }
@@ -51,6 +58,12 @@ template <>
 std::shared_ptr<t_ctx0>
 make_context(std::shared_ptr<Table> table, std::shared_ptr<t_schema> schema,
     std::shared_ptr<t_view_config> view_config, const std::string& name) {
+    auto key = std::to_string(ZERO_SIDED_CONTEXT) + view_config->get_context_key();
+    auto shared_ctx = table->acquire_context<t_ctx0>(key);
+    if (shared_ctx) {
+        return shared_ctx;
+    }
+
     auto columns = view_config->get_columns();
     auto filter_op = view_config->get_filter_op();
     auto fterm = view_config->get_fterm();
@@ -66,6 +79,7 @@ make_context(std::shared_ptr<Table> table, std::shared_ptr<t_schema> schema,
     auto gnode = table->get_gnode();
     pool->register_context(gnode->get_id(), name, ZERO_SIDED_CONTEXT,
         reinterpret_cast<std::uintptr_t>(ctx0.get()));
+    table->share_context(key, name, ctx0);
 
     return ctx0;
 }
@@ -90,6 +104,10 @@ make_context(std::shared_ptr<Table> table, std::shared_ptr<t_schema> schema,
 
     auto pool = table->get_pool();
     auto gnode = table->get_gnode();
+
+    // Configure the context under the pool lock, so the engine thread does
+    // not process it between registration and `set_depth`.
+    auto lk = pool->lock();
     pool->register_context(gnode->get_id(), name, ONE_SIDED_CONTEXT,
         reinterpret_cast<std::uintptr_t>(ctx1.get()));
 
@@ -128,6 +146,9 @@ make_context(std::shared_ptr<Table> table, std::shared_ptr<t_schema> schema,
 
     auto pool = table->get_pool();
     auto gnode = table->get_gnode();
+
+    // Configure the context under the pool lock, as for `t_ctx1`.
+    auto lk = pool->lock();
     pool->register_context(gnode->get_id(), name, TWO_SIDED_CONTEXT,
         reinterpret_cast<std::uintptr_t>(ctx2.get()));
 
@@ -10,6 +10,7 @@
 
 #include <perspective/base.h>
 #include <perspective/binding.h>
+#include <perspective/date_parser.h>
 #include <perspective/python/base.h>
 #include <perspective/python/fill.h>
 #include <perspective/python/utils.h>
@@ -22,56 +23,158 @@ namespace binding {
  * Fill columns with data
  */
 
-void
-_fill_col_time(t_data_accessor accessor, std::shared_ptr<t_column> col, std::string name,
-    std::int32_t cidx, t_dtype type, bool is_update) {
-    t_uindex nrows = col->size();
+namespace {
+    /**
+     * Convert a parsed date string into milliseconds since epoch, as
+     * `_PerspectiveDateValidator.to_timestamp` does for the `datetime` that
+     * `dateutil` returns: naive datetimes are in local time (or UTC before
+     * 1900), aware datetimes are converted to UTC, and `datetime.min` is 0.
+     *
+     * Returns false if Python would have raised, so that the string is
+     * marshalled by the accessor instead.
+     */
+    bool
+    parsed_to_timestamp(const t_parsed_datetime& parsed, std::int64_t& out) {
+        static const std::int64_t DATETIME_MIN_MS = -62135596800000;
+
+        if (parsed.m_has_tz_offset) {
+            std::int64_t ms = parsed.to_epoch_ms();
+            std::int64_t seconds_ms = ms - parsed.m_millisecond;
+            if (seconds_ms < DATETIME_MIN_MS) {
+                return false;
+            }
 
-    for (auto i = 0; i < nrows; ++i) {
-        if (!accessor.attr("_has_column")(i, name).cast<bool>()) {
-            continue;
+            out = seconds_ms == DATETIME_MIN_MS ? 0 : ms;
+            return true;
         }
 
-        t_val item = accessor.attr("marshal")(cidx, i, type);
+        if (parsed.m_year == 1 && parsed.m_month == 1 && parsed.m_day == 1
+            && parsed.m_hour == 0 && parsed.m_minute == 0 && parsed.m_second == 0) {
+            out = 0;
+            return true;
+        }
+
+        if (parsed.m_year < 1900) {
+            out = parsed.to_epoch_ms();
+            return true;
+        }
+
+        return parsed.to_local_epoch_ms(out);
+    }
 
+    void
+    set_datetime_item(std::shared_ptr<t_column> col, t_uindex idx, t_val item, t_dtype type,
+        bool is_update) {
         if (item.is_none()) {
             if (is_update) {
-                col->unset(i);
+                col->unset(idx);
             } else {
-                col->clear(i);
+                col->clear(idx);
             }
-            continue;
+            return;
         }
 
-        col->set_nth(i, item.cast<std::int64_t>());
+        if (type == DTYPE_DATE) {
+            auto date_components = item.cast<std::map<std::string, std::int32_t>>();
+            // date_components["month"] should be [0-11]
+            t_date dt = t_date(date_components["year"], date_components["month"], date_components["day"]);
+            col->set_nth(idx, dt);
+        } else {
+            col->set_nth(idx, item.cast<std::int64_t>());
+        }
     }
-}
+} // namespace
 
 void
-_fill_col_date(t_data_accessor accessor, std::shared_ptr<t_column> col, std::string name,
-    std::int32_t cidx, t_dtype type, bool is_update) {
+_fill_col_datetime(t_data_accessor accessor, std::shared_ptr<t_column> col, const std::string& name,
+    std::int32_t cidx, t_dtype type, bool is_update, bool check_has_column) {
     t_uindex nrows = col->size();
+    std::vector<t_uindex> string_rows;
+    std::vector<std::string> strings;
 
-    for (auto i = 0; i < nrows; ++i) {
-        if (!accessor.attr("_has_column")(i, name).cast<bool>()) {
+    if (nrows == 0) {
+        return;
+    }
+
+    // Read cells from the dataset directly, under the name `marshal` reads
+    // them by, rather than through `accessor.get` and `_has_column` calls
+    // per cell. Reserved columns are always written, as in `_has_column`.
+    py::object data = accessor.attr("data")();
+    py::str key = accessor.attr("names")()[py::int_(cidx)].cast<py::str>();
+    bool is_records = accessor.attr("format")().cast<std::int32_t>() == 0;
+    bool skip_missing = check_has_column && name != "psp_pkey" && name != "psp_okey"
+        && name != "psp_op";
+    py::object column;
+    t_uindex column_size = 0;
+
+    if (!is_records) {
+        if (data.contains(key)) {
+            column = data[key];
+            column_size = py::len(column);
+        } else if (skip_missing) {
+            return;
+        }
+    }
+
+    for (t_uindex i = 0; i < nrows; ++i) {
+        t_val value = py::none();
+        if (is_records) {
+            py::object row = data[py::int_(i)];
+            if (row.contains(key)) {
+                value = row[key];
+            } else if (skip_missing) {
+                continue;
+            }
+        } else if (i < column_size) {
+            value = column[py::int_(i)];
+        }
+
+        if (py::isinstance<py::str>(value)) {
+            string_rows.push_back(i);
+            strings.push_back(value.cast<std::string>());
             continue;
         }
 
-        t_val item = accessor.attr("marshal")(cidx, i, type);
+        set_datetime_item(col, i, accessor.attr("marshal")(cidx, i, type), type, is_update);
+    }
 
-        if (item.is_none()) {
-            if (is_update) {
-                col->unset(i);
+    if (strings.empty()) {
+        return;
+    }
+
+    // Parse the whole column without the GIL, leaving strings in formats
+    // `t_date_parser` does not recognize to `dateutil`.
+    std::vector<bool> parsed_rows(strings.size(), false);
+    {
+        py::gil_scoped_release release;
+        t_date_parser parser;
+
+        for (t_uindex j = 0; j < strings.size(); ++j) {
+            const std::string& str = strings[j];
+            t_parsed_datetime parsed;
+
+            if (!parser.parse_extended(str.c_str(), str.size(), parsed)) {
+                continue;
+            }
+
+            if (type == DTYPE_DATE) {
+                col->set_nth(string_rows[j], t_date(parsed.m_year, parsed.m_month - 1, parsed.m_day));
+                parsed_rows[j] = true;
             } else {
-                col->clear(i);
+                std::int64_t timestamp;
+                if (parsed_to_timestamp(parsed, timestamp)) {
+                    col->set_nth(string_rows[j], timestamp);
+                    parsed_rows[j] = true;
+                }
             }
-            continue;
         }
+    }
 
-
-        auto date_components = item.cast<std::map<std::string, std::int32_t>>();
-        t_date dt = t_date(date_components["year"], date_components["month"], date_components["day"]);
-        col->set_nth(i, dt);
+    for (t_uindex j = 0; j < strings.size(); ++j) {
+        if (!parsed_rows[j]) {
+            t_uindex ridx = string_rows[j];
+            set_datetime_item(col, ridx, accessor.attr("marshal")(cidx, ridx, type), type, is_update);
+        }
     }
 }
 
@@ -344,11 +447,9 @@ _fill_data_helper(t_data_accessor accessor, t_data_table& tbl,
         case DTYPE_BOOL: {
             _fill_col_bool(accessor, col, name, cidx, type, is_update);
         } break;
-        case DTYPE_DATE: {
-            _fill_col_date(accessor, col, name, cidx, type, is_update);
-        } break;
+        case DTYPE_DATE:
         case DTYPE_TIME: {
-            _fill_col_time(accessor, col, name, cidx, type, is_update);
+            _fill_col_datetime(accessor, col, name, cidx, type, is_update, true);
         } break;
         case DTYPE_STR: {
             _fill_col_string(accessor, col, name, cidx, type, is_update);
@@ -9,6 +9,9 @@
 #ifdef PSP_ENABLE_PYTHON
 #include <perspective/python/fill.h>
 #include <perspective/python/numpy.h>
+#include <cmath>
+#include <limits>
+#include <type_traits>
 
 using namespace perspective;
 
@@ -89,6 +92,7 @@ namespace numpy {
         bool implicit_index = false;
         std::vector<std::string> col_names(input_schema.columns());
         std::vector<t_dtype> data_types(input_schema.types());
+        std::vector<t_bulk_fill> bulk_fills;
 
         for (auto cidx = 0; cidx < col_names.size(); ++cidx) {
             auto name = col_names[cidx];
@@ -103,9 +107,11 @@ namespace numpy {
             }
 
             auto col = tbl.get_column(name);
-            fill_column(tbl, col, name, type, cidx, is_update);
+            fill_column(tbl, col, name, type, cidx, is_update, bulk_fills);
         }
 
+        fill_bulk(tbl, bulk_fills, is_update);
+
         // Fill index column - recreated every time a `t_data_table` is created.
         if (!implicit_index) {
             if (index == "") {
@@ -127,6 +133,13 @@ namespace numpy {
     
     void 
     NumpyLoader::fill_column(t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name, t_dtype type, std::uint32_t cidx, bool is_update) {
+        std::vector<t_bulk_fill> bulk_fills;
+        fill_column(tbl, col, name, type, cidx, is_update, bulk_fills);
+        fill_bulk(tbl, bulk_fills, is_update);
+    }
+
+    void 
+    NumpyLoader::fill_column(t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name, t_dtype type, std::uint32_t cidx, bool is_update, std::vector<t_bulk_fill>& bulk_fills) {
         PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
 
         // Use name index instead of column index - prevents off-by-one errors with the "index" column.
@@ -154,8 +167,24 @@ namespace numpy {
             return;
         }
 
+        t_bulk_fill fill;
+        fill.m_col = col;
+        fill.m_name = name;
+        fill.m_cidx = cidx;
+        fill.m_np_dtype = np_dtype;
+        fill.m_type = type;
+        fill.m_cast = false;
+        fill.m_filled = false;
+        fill.m_array = array;
+        fill.m_mask = mask;
+
         // Datetimes are not trivially copyable - they are float64 values that need to be read as int64
         if (type == DTYPE_TIME || type == DTYPE_DATE) {
+            if (type == DTYPE_TIME && np_dtype == DTYPE_TIME) {
+                bulk_fills.push_back(fill);
+                return;
+            }
+
             fill_column_iter(array, tbl, col, name, np_dtype, type, cidx, is_update);
             fill_validity_map(col, mask_ptr, mask_size, is_update);
             return;
@@ -177,20 +206,68 @@ namespace numpy {
             (type == DTYPE_INT64 && (np_dtype == DTYPE_FLOAT32 || np_dtype == DTYPE_FLOAT64));
 
         if (should_iter) {
-            // Skip straight to numeric fill
-            fill_numeric_iter(array, tbl, col, name, np_dtype, type, cidx, is_update);
+            // Convert in bulk, falling back to numeric fill if the column must be promoted
+            fill.m_cast = true;
+            bulk_fills.push_back(fill);
             return;
         }
 
-        bool copy_status = try_copy_array(array, col, np_dtype, type, 0);
-
         // Iterate if copy is not supported for the numpy array
-        if (copy_status == t_fill_status::FILL_FAIL) {
+        if (np_dtype != DTYPE_BOOL && !is_numeric_type(np_dtype)) {
             fill_column_iter(array, tbl, col, name, np_dtype, type, cidx, is_update);
+            fill_validity_map(col, mask_ptr, mask_size, is_update);
+            return;
         }
-        
+
+        bulk_fills.push_back(fill);
+    }
+
+    void
+    NumpyLoader::fill_bulk(t_data_table& tbl, std::vector<t_bulk_fill>& bulk_fills, bool is_update) {
+        PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+
+        // Arrays have already been read from the accessor, so columns can be filled independently.
+#ifdef PSP_PARALLEL_FOR
+        tbb::parallel_for(0, int(bulk_fills.size()), 1,
+            [&bulk_fills, is_update, this](int idx)
+#else
+        for (t_uindex idx = 0, loop_end = bulk_fills.size(); idx < loop_end; ++idx)
+#endif
+            {
+                fill_column_bulk(bulk_fills[idx], is_update);
+            }
+#ifdef PSP_PARALLEL_FOR
+        );
+#endif
+
+        // Promotion calls back into Python and replaces the column in `tbl`, so it is left to the serial path.
+        for (auto& fill : bulk_fills) {
+            if (!fill.m_filled) {
+                fill_numeric_iter(fill.m_array, tbl, fill.m_col, fill.m_name, fill.m_np_dtype, fill.m_type, fill.m_cidx, is_update);
+            }
+        }
+    }
+
+    void
+    NumpyLoader::fill_column_bulk(t_bulk_fill& fill, bool is_update) {
+        const void* ptr = fill.m_array.data();
+
+        if (fill.m_cast) {
+            // Casts mark NaNs as null themselves, as `fill_numeric_iter` did.
+            t_fill_status cast_status = try_cast_array(ptr, fill.m_col, fill.m_np_dtype, fill.m_type, is_update);
+            fill.m_filled = cast_status == t_fill_status::FILL_SUCCESS;
+            return;
+        }
+
+        if (fill.m_type == DTYPE_TIME) {
+            copy_datetime_helper(ptr, fill.m_col);
+        } else {
+            try_copy_array(fill.m_array, fill.m_col, fill.m_np_dtype, fill.m_type, 0);
+        }
+
         // Fill validity map using null mask
-        fill_validity_map(col, mask_ptr, mask_size, is_update);
+        fill_validity_map(fill.m_col, (std::uint64_t*) fill.m_mask.data(), fill.m_mask.size(), is_update);
+        fill.m_filled = true;
     }
 
     template <typename T>
@@ -323,7 +400,9 @@ namespace numpy {
         switch (type) {
             case DTYPE_TIME: {
                 // covers dtype `datetime64[us/ns/ms/s]`, date strings, and integer timestamps in ms or s since epoch
-                if (np_dtype != DTYPE_TIME) {
+                if (np_dtype == DTYPE_OBJECT) {
+                    binding::_fill_col_datetime(m_accessor, col, name, cidx, type, is_update, false);
+                } else if (np_dtype != DTYPE_TIME) {
                     fill_object_iter<std::int64_t>(tbl, col, name, np_dtype, type, cidx, is_update);
                 } else {
                     fill_datetime_iter(array, tbl, col, name, np_dtype, type, cidx, is_update);
@@ -357,64 +436,31 @@ namespace numpy {
     NumpyLoader::fill_datetime_iter(const py::array& array, t_data_table& tbl, std::shared_ptr<t_column> col, 
         const std::string& name, t_dtype np_dtype, t_dtype type, std::uint32_t cidx, bool is_update) {
         PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
-        t_uindex nrows = col->size();
-
-        // read the array as a double array because of `numpy.nat`
-        double* ptr = (double*) array.data();
-
-        for (auto i = 0; i < nrows; ++i) {
-            std::int64_t item = ptr[i]; // Perspective stores datetimes using int64
-            col->set_nth(i, item);
-        }
+        copy_datetime_helper(array.data(), col);
     }
 
     void
     NumpyLoader::fill_date_iter(std::shared_ptr<t_column> col, const std::string& name, t_dtype np_dtype, t_dtype type, std::uint32_t cidx, bool is_update) {
         PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
-        t_uindex nrows = col->size();
-
-        for (auto i = 0; i < nrows; ++i) {
-            t_val item = m_accessor.attr("marshal")(cidx, i, type);
-
-            if (item.is_none()) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
-                continue;
-            }
-
-            auto date_components = item.cast<std::map<std::string, std::int32_t>>();
-            // date_components["month"] should be [0-11]
-            t_date dt = t_date(date_components["year"], date_components["month"], date_components["day"]);
-            col->set_nth(i, dt);
-        }
+        binding::_fill_col_datetime(m_accessor, col, name, cidx, type, is_update, false);
     }
 
     void
     NumpyLoader::fill_bool_iter(const py::array& array, t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name, t_dtype np_dtype, t_dtype type, std::uint32_t cidx, bool is_update) {
         PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
-        t_uindex nrows = col->size();
 
         // handle Nan/None in boolean array with dtype=object
         if (np_dtype == DTYPE_OBJECT) {
             // handle object arrays
             fill_object_iter<bool>(tbl, col, name, np_dtype, type, cidx, is_update); 
         } else {
-            bool* ptr = (bool*) array.data(); 
-
-            for (auto i = 0; i < nrows; ++i) {
-                bool item = ptr[i];
-                col->set_nth(i, item);
-            }
+            cast_array_helper<bool, bool>(array.data(), col, is_update, false);
         }
     }
 
     void 
     NumpyLoader::fill_numeric_iter(const py::array& array, t_data_table& tbl, std::shared_ptr<t_column> col, const std::string& name, t_dtype np_dtype, t_dtype type, std::uint32_t cidx, bool is_update) {
         PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
-        t_uindex nrows = col->size();
         const void* ptr = array.data();
 
         // We fill by object when `np_dtype`=object, or if there are type mismatches between `np_dtype` and `type`.
@@ -470,52 +516,40 @@ namespace numpy {
             }
         }
 
-        // Iterate through the C++ array and try to cast. Array is guaranteed to be of the correct dtype and consistent in its values.
-        for (auto i = 0; i < nrows; ++i) {
-            if (isnan(((double*) ptr)[i]) || npy_isnan(((double*) ptr)[i])) {
-                if (is_update) {
-                    col->unset(i);
-                } else {
-                    col->clear(i);
-                }
-                continue;
-            }
-
-            switch (type) {
-                case DTYPE_UINT8: {
-                    col->set_nth(i, ((std::uint8_t*)ptr)[i]);
-                } break;
-                case DTYPE_UINT16: {
-                    col->set_nth(i, ((std::uint16_t*)ptr)[i]);
-                } break;
-                case DTYPE_UINT32: {
-                    col->set_nth(i, ((std::uint32_t*)ptr)[i]);
-                } break;
-                case DTYPE_UINT64: {
-                    col->set_nth(i, ((std::uint64_t*)ptr)[i]);
-                } break;
-                case DTYPE_INT8: {
-                    col->set_nth(i, ((std::int8_t*)ptr)[i]);
-                } break;
-                case DTYPE_INT16: {
-                    col->set_nth(i, ((std::int16_t*)ptr)[i]);
-                } break;
-                case DTYPE_INT32: {
-                    // No need for promotion logic if array is consistent
-                    col->set_nth<std::int32_t>(i, ((std::int32_t*) ptr)[i]);
-                } break;
-                case DTYPE_INT64: {
-                    col->set_nth<std::int64_t>(i, ((std::int64_t*) ptr)[i]);
-                } break;
-                case DTYPE_FLOAT32: {
-                    col->set_nth(i, ((float*) ptr)[i]);
-                } break;
-                case DTYPE_FLOAT64: {
-                    col->set_nth<double>(i, ((double*)ptr)[i]);
-                } break;
-                default:
-                    break;
-            }
+        // The array is guaranteed to be of the correct dtype and consistent in its values, so convert it in bulk.
+        switch (type) {
+            case DTYPE_UINT8: {
+                cast_array_helper<std::uint8_t, std::uint8_t>(ptr, col, is_update, false);
+            } break;
+            case DTYPE_UINT16: {
+                cast_array_helper<std::uint16_t, std::uint16_t>(ptr, col, is_update, false);
+            } break;
+            case DTYPE_UINT32: {
+                cast_array_helper<std::uint32_t, std::uint32_t>(ptr, col, is_update, false);
+            } break;
+            case DTYPE_UINT64: {
+                cast_array_helper<std::uint64_t, std::uint64_t>(ptr, col, is_update, false);
+            } break;
+            case DTYPE_INT8: {
+                cast_array_helper<std::int8_t, std::int8_t>(ptr, col, is_update, false);
+            } break;
+            case DTYPE_INT16: {
+                cast_array_helper<std::int16_t, std::int16_t>(ptr, col, is_update, false);
+            } break;
+            case DTYPE_INT32: {
+                cast_array_helper<std::int32_t, std::int32_t>(ptr, col, is_update, false);
+            } break;
+            case DTYPE_INT64: {
+                cast_array_helper<std::int64_t, std::int64_t>(ptr, col, is_update, false);
+            } break;
+            case DTYPE_FLOAT32: {
+                cast_array_helper<float, float>(ptr, col, is_update, false);
+            } break;
+            case DTYPE_FLOAT64: {
+                cast_array_helper<double, double>(ptr, col, is_update, false);
+            } break;
+            default:
+                break;
         }
     }
 
@@ -568,6 +602,48 @@ namespace numpy {
         return t_fill_status::FILL_SUCCESS;
     }
 
+    t_fill_status
+    NumpyLoader::try_cast_array(const void* src, std::shared_ptr<t_column> dest, t_dtype np_dtype, t_dtype type, bool is_update) {
+        PSP_VERBOSE_ASSERT(m_init, "touching uninited object");
+        bool cast = false;
+
+        // Out of range values promote int32 columns to float64 on creation, so they are checked for first.
+        bool check_range = !is_update;
+
+        switch (np_dtype) {
+            case DTYPE_INT32: {
+                if (type == DTYPE_INT64) {
+                    cast = cast_array_helper<std::int32_t, std::int64_t>(src, dest, is_update, false);
+                } else if (type == DTYPE_FLOAT64) {
+                    cast = cast_array_helper<std::int32_t, double>(src, dest, is_update, false);
+                }
+            } break;
+            case DTYPE_INT64: {
+                if (type == DTYPE_INT32) {
+                    cast = cast_array_helper<std::int64_t, std::int32_t>(src, dest, is_update, check_range);
+                } else if (type == DTYPE_FLOAT64) {
+                    cast = cast_array_helper<std::int64_t, double>(src, dest, is_update, false);
+                }
+            } break;
+            case DTYPE_FLOAT32: {
+                if (type == DTYPE_INT64) {
+                    cast = cast_array_helper<float, std::int64_t>(src, dest, is_update, false);
+                }
+            } break;
+            case DTYPE_FLOAT64: {
+                if (type == DTYPE_INT32) {
+                    cast = cast_array_helper<double, std::int32_t>(src, dest, is_update, check_range);
+                } else if (type == DTYPE_INT64) {
+                    cast = cast_array_helper<double, std::int64_t>(src, dest, is_update, false);
+                }
+            } break;
+            default:
+                break;
+        }
+
+        return cast ? t_fill_status::FILL_SUCCESS : t_fill_status::FILL_FAIL;
+    }
+
     void
     NumpyLoader::fill_validity_map(
         std::shared_ptr<t_column> col, std::uint64_t* mask_ptr, std::size_t mask_size, bool is_update) {
@@ -591,6 +667,51 @@ namespace numpy {
         std::memcpy(dest->get_nth<T>(offset), src, dest->size() * sizeof(T));
     }
 
+    template <typename SRC_T, typename DST_T>
+    bool cast_array_helper(const void* src, std::shared_ptr<t_column> dest, bool is_update, bool check_range) {
+        const SRC_T* src_ptr = static_cast<const SRC_T*>(src);
+        t_uindex nrows = dest->size();
+
+        if (check_range) {
+            for (t_uindex i = 0; i < nrows; ++i) {
+                // Fractions are truncated, as `marshal` does with `int()`.
+                double fval = std::trunc(static_cast<double>(src_ptr[i]));
+                if (fval > std::numeric_limits<DST_T>::max() || fval < std::numeric_limits<DST_T>::lowest()) {
+                    return false;
+                }
+            }
+        }
+
+        DST_T* dst_ptr = dest->get_nth<DST_T>(0);
+        dest->valid_raw_fill();
+
+        for (t_uindex i = 0; i < nrows; ++i) {
+            SRC_T item = src_ptr[i];
+
+            // Integer arrays cannot hold NaN, so only floating point sources are checked.
+            if (std::is_floating_point<SRC_T>::value && std::isnan(static_cast<double>(item))) {
+                dest->clear(i, is_update ? STATUS_CLEAR : STATUS_INVALID);
+                continue;
+            }
+
+            dst_ptr[i] = static_cast<DST_T>(item);
+        }
+
+        return true;
+    }
+
+    void copy_datetime_helper(const void* src, std::shared_ptr<t_column> dest) {
+        const double* src_ptr = static_cast<const double*>(src);
+        std::int64_t* dst_ptr = dest->get_nth<std::int64_t>(0);
+        t_uindex nrows = dest->size();
+
+        for (t_uindex i = 0; i < nrows; ++i) {
+            // Perspective stores datetimes using int64
+            double item = src_ptr[i];
+            dst_ptr[i] = std::isnan(item) ? 0 : static_cast<std::int64_t>(item);
+        }
+    }
+
     /******************************************************************************
      *
      * Generate metadata for numpy arrays
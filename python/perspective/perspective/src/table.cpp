@@ -9,6 +9,7 @@
 #ifdef PSP_ENABLE_PYTHON
 
 #include <perspective/arrow_loader.h>
+#include <perspective/json_loader.h>
 #include <perspective/base.h>
 #include <perspective/binding.h>
 #include <perspective/python/accessor.h>
@@ -42,6 +43,9 @@ std::shared_ptr<Table> make_table_py(t_val table, t_data_accessor accessor,
         pool = tbl->get_pool();
         gnode = tbl->get_gnode();
         offset = tbl->get_offset();
+
+        // The engine thread may be processing the gnode.
+        auto lk = pool->lock();
         is_update = (is_update || gnode->mapping_size() > 0);
     } else {
         pool = std::make_shared<t_pool>();
@@ -50,10 +54,15 @@ std::shared_ptr<Table> make_table_py(t_val table, t_data_accessor accessor,
     std::vector<std::string> column_names;
     std::vector<t_dtype> data_types;
     ArrowLoader arrow_loader;
+    json::JsonLoader json_loader;
     numpy::NumpyLoader numpy_loader(accessor);
 
-    // don't call `is_numpy` on an arrow binary
-    bool is_numpy = !is_arrow && accessor.attr("_is_numpy").cast<bool>();
+    // A `str` dataset is JSON or newline-delimited JSON, which is parsed
+    // without converting it to Python objects.
+    bool is_json = !is_arrow && py::isinstance<py::str>(accessor);
+
+    // don't call `is_numpy` on an arrow binary or a JSON string
+    bool is_numpy = !is_arrow && !is_json && accessor.attr("_is_numpy").cast<bool>();
 
     // Determine metadata
     bool is_delete = op == OP_DELETE;
@@ -62,13 +71,19 @@ std::shared_ptr<Table> make_table_py(t_val table, t_data_accessor accessor,
         std::int32_t size = bytes.attr("__len__")().cast<std::int32_t>();
         ptr = malloc(size);
         std::memcpy(ptr, bytes.cast<std::string>().c_str(), size);
+
+        // `ptr` is freed with the last column that points into it, which
+        // may be after the update has been processed.
+        std::shared_ptr<void> arrow_owner(ptr, free);
         {
             PerspectiveScopedGILRelease acquire(pool->get_event_loop_thread_id());
         
             arrow_loader.initialize((uintptr_t)ptr, size);
+            arrow_loader.set_zero_copy(arrow_owner);
 
             // Always use the `Table` column names and data types on update.
             if (table_initialized && is_update) {
+                auto lk = pool->lock();
                 auto gnode_output_schema = gnode->get_output_schema();
                 auto schema = gnode_output_schema.drop({"psp_okey"});
                 column_names = schema.columns();
@@ -112,6 +127,23 @@ std::shared_ptr<Table> make_table_py(t_val table, t_data_accessor accessor,
                 data_types = arrow_loader.types();
             }
         }
+    } else if (is_json && !is_delete) {
+        std::string json = accessor.cast<std::string>();
+        {
+            PerspectiveScopedGILRelease acquire(pool->get_event_loop_thread_id());
+            json_loader.initialize(std::move(json));
+
+            // Always use the `Table` column names and data types on update.
+            if (table_initialized && is_update) {
+                auto lk = pool->lock();
+                auto schema = gnode->get_output_schema().drop({"psp_okey"});
+                column_names = schema.columns();
+                data_types = schema.types();
+            } else {
+                column_names = json_loader.names();
+                data_types = json_loader.types();
+            }
+        }
     } else if (is_update || is_delete) {
         /**
          * Use the names and types of the python accessor when updating/deleting.
@@ -184,6 +216,11 @@ std::shared_ptr<Table> make_table_py(t_val table, t_data_accessor accessor,
         row_count = arrow_loader.row_count();
         data_table.extend(arrow_loader.row_count());
         arrow_loader.fill_table(data_table, input_schema, index, offset, limit, is_update);
+    } else if (is_json) {
+        PerspectiveScopedGILRelease acquire(pool->get_event_loop_thread_id());
+        row_count = json_loader.row_count();
+        data_table.extend(row_count);
+        json_loader.fill_table(data_table, input_schema, index, offset, limit, is_update);
     } else if (is_numpy) {
         row_count = numpy_loader.row_count();
         data_table.extend(row_count);
@@ -194,10 +231,6 @@ std::shared_ptr<Table> make_table_py(t_val table, t_data_accessor accessor,
         _fill_data(data_table, accessor, input_schema, index, offset, limit, is_update);
     }
 
-    if (is_arrow) {
-        free(ptr);
-    }
-
     // calculate offset, limit, and set the gnode
     tbl->init(data_table, row_count, op, port_id);    
 
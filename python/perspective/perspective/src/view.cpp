@@ -367,24 +367,21 @@ to_arrow_two(
 py::bytes
 get_row_delta_unit(std::shared_ptr<View<t_ctxunit>> view) {
     PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<t_data_slice<t_ctxunit>> slice = view->get_row_delta();
-    std::shared_ptr<std::string> arrow = view->data_slice_to_arrow(slice);
+    std::shared_ptr<std::string> arrow = view->get_row_delta_arrow();
     return py::bytes(*arrow);
 }
 
 py::bytes
 get_row_delta_zero(std::shared_ptr<View<t_ctx0>> view) {
     PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<t_data_slice<t_ctx0>> slice = view->get_row_delta();
-    std::shared_ptr<std::string> arrow = view->data_slice_to_arrow(slice);
+    std::shared_ptr<std::string> arrow = view->get_row_delta_arrow();
     return py::bytes(*arrow);
 }
 
 py::bytes
 get_row_delta_one(std::shared_ptr<View<t_ctx1>> view) {
     PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<t_data_slice<t_ctx1>> slice = view->get_row_delta();
-    std::shared_ptr<std::string> arrow = view->data_slice_to_arrow(slice);
+    std::shared_ptr<std::string> arrow = view->get_row_delta_arrow();
     return py::bytes(*arrow);
 }
 
@@ -392,8 +389,7 @@ py::bytes
 get_row_delta_two(
     std::shared_ptr<View<t_ctx2>> view) {
     PerspectiveScopedGILRelease acquire(view->get_event_loop_thread_id());
-    std::shared_ptr<t_data_slice<t_ctx2>> slice = view->get_row_delta();
-    std::shared_ptr<std::string> arrow = view->data_slice_to_arrow(slice);
+    std::shared_ptr<std::string> arrow = view->get_row_delta_arrow();
     return py::bytes(*arrow);
 }
 
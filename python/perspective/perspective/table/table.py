@@ -39,7 +39,9 @@ class Table(object):
 
         Args:
             data (:obj:`dict`/:obj:`list`/:obj:`pandas.DataFrame`): Data or
-                schema which initializes the :class:`~perspective.Table`.
+                schema which initializes the :class:`~perspective.Table`. A
+                :obj:`str` is parsed as JSON records, JSON columns or
+                newline-delimited JSON records.
 
         Keyword Args:
             index (:obj:`str`): A string column name to use as the
@@ -50,7 +52,8 @@ class Table(object):
                 writing at row 0.
         """
         self._is_arrow = isinstance(data, (bytes, bytearray))
-        if self._is_arrow:
+        if self._is_arrow or isinstance(data, string_types):
+            # Arrow binaries and JSON strings are read directly by the C++
             _accessor = data
         else:
             _accessor = _PerspectiveAccessor(data)
@@ -111,6 +114,46 @@ class Table(object):
         specified by the user."""
         return self._limit
 
+    def start_engine(self, interval_ms=0):
+        """Process updates to this :class:`~perspective.Table` on a dedicated
+        engine thread, so that :func:`~perspective.Table.update` returns
+        without waiting for them to be processed.
+
+        While the engine runs, updates are queued and processed every
+        ``interval_ms`` milliseconds, each port once for everything queued
+        since the last pass, and ``on_update`` callbacks are called from the
+        engine thread. Reads from other threads, such as
+        :func:`~perspective.View.to_records`, see the last processed state.
+        The engine cannot be started on a :class:`~perspective.Table` that
+        is processed by a :class:`~perspective.PerspectiveManager` event
+        loop.
+
+        Keyword Args:
+            interval_ms (:obj:`int`): How long queued updates accumulate
+                before they are processed. With ``0``, updates are processed
+                as soon as the engine thread wakes.
+
+        Examples:
+            >>> tbl = Table({"a": [1, 2, 3]})
+            >>> tbl.start_engine(interval_ms=50)
+            >>> tbl.update({"a": [4]})
+            >>> tbl.stop_engine()
+            >>> tbl.size()
+            4
+        """
+        self._table.get_pool().start_engine(interval_ms)
+
+    def stop_engine(self):
+        """Stop the engine thread started by
+        :func:`~perspective.Table.start_engine`, after processing every
+        update still queued. Subsequent updates are processed as before.
+        """
+        self._table.get_pool().stop_engine()
+
+    def is_engine_running(self):
+        """Returns whether updates are processed on an engine thread."""
+        return self._table.get_pool().is_engine_running()
+
     def clear(self):
         """Removes all the rows in the :class:`~perspective.Table`, but
         preserves everything else including the schema and any callbacks or
@@ -158,6 +201,20 @@ class Table(object):
         self._state_manager.call_process(self._table.get_id())
         return self._table.size()
 
+    def memory_usage(self):
+        """Returns the bytes allocated by the :class:`~perspective.Table`, by
+        category: ``master_table``, ``mapping``, ``input_ports`` and
+        ``transitional_tables``.
+
+        Memory held by each :class:`~perspective.View` is reported by
+        :func:`~perspective.View.memory_usage`, and is not included.
+
+        Returns:
+            :obj:`dict`: A dictionary of category names to bytes.
+        """
+        self._state_manager.call_process(self._table.get_id())
+        return self._table.get_memory_usage()
+
     def schema(self, as_string=False):
         """Returns the schema of this :class:`~perspective.Table`, a :obj:`dict`
         mapping of string column names to python data types.
@@ -298,7 +355,8 @@ class Table(object):
 
         Args:
             data (:obj:`dict`/:obj:`list`/:obj:`pandas.DataFrame`): The data
-                with which to update the :class:`~perspective.Table`.
+                with which to update the :class:`~perspective.Table`. A
+                :obj:`str` is parsed as JSON, as in the constructor.
 
         Examples:
             >>> tbl = Table({"a": [1, 2, 3], "b": ["a", "b", "c"]}, index="a")
@@ -311,7 +369,7 @@ class Table(object):
 
         _is_arrow = isinstance(data, (bytes, bytearray))
 
-        if _is_arrow:
+        if _is_arrow or isinstance(data, string_types):
             _accessor = data
             self._table = make_table(
                 self._table,
@@ -320,7 +378,7 @@ class Table(object):
                 self._index or "",
                 t_op.OP_INSERT,
                 True,
-                True,
+                _is_arrow,
                 port_id,
             )
             self._state_manager.set_process(
@@ -519,6 +577,7 @@ class Table(object):
                 "Cannot delete a Table with active views still linked to it "
                 + "- call delete() on each view, and try again."
             )
+        self.stop_engine()
         self._state_manager.remove_process(self._table.get_id())
         self._table.unregister_gnode(self._gnode_id)
         [cb() for cb in self._delete_callbacks]
@@ -159,6 +159,17 @@ class View(object):
         """
         return self._view.num_columns()
 
+    def memory_usage(self):
+        """The bytes allocated by the :class:`~perspective.View`'s context,
+        by category, i.e. ``tree``, ``aggregates``, ``traversal``,
+        ``deltas`` and ``symtable``.
+
+        Returns:
+            :obj:`dict`: A dictionary of category names to bytes.
+        """
+        self._table._state_manager.call_process(self._table._table.get_id())
+        return self._view.get_memory_usage()
+
     def get_row_expanded(self, idx):
         """Returns whether row at `idx` is expanded or collapsed.
 
@@ -8,7 +8,8 @@
 
 import json
 import random
-from perspective import Table, PerspectiveManager
+from pytest import raises
+from perspective import Table, PerspectiveError, PerspectiveManager
 
 data = {"a": [1, 2, 3], "b": ["a", "b", "c"]}
 
@@ -24,6 +25,15 @@ class TestPerspectiveSession(object):
         if expected:
             assert msg == expected
 
+    def _drain(self, queue):
+        '''Pop every frame from an outbound queue, decoded from JSON.'''
+        frames = []
+        while True:
+            popped = queue.pop()
+            if popped is None:
+                return frames
+            frames.extend(json.loads(data) for data, _ in popped)
+
     # test session
     def test_session_new_session(self, sentinel):
         s = sentinel(False)
@@ -243,4 +253,104 @@ class TestPerspectiveSession(object):
         for callback in manager._callback_cache:
             assert callback["client_id"] != random_client_id
 
-        assert len(manager._callback_cache) == 4
\ No newline at end of file
+        assert len(manager._callback_cache) == 4
+
+    def test_session_outbound_queue_conflates_updates(self):
+        manager = PerspectiveManager()
+        session = manager.new_session()
+        queue = session.outbound_queue()
+        manager.host_table("table1", Table(data))
+
+        session.process({"id": 1, "table_name": "table1", "view_name": "view1", "cmd": "view"}, queue)
+        session.process({"id": 2, "name": "view1", "cmd": "view_method", "subscribe": True, "method": "on_update", "callback_id": "callback_1"}, queue)
+        assert self._drain(queue) == []
+
+        for i in range(5):
+            manager.get_table("table1").update({"a": [i], "b": [str(i)]})
+
+        # one pending notification per view, regardless of the update count
+        assert self._drain(queue) == [{"id": 2, "data": {"port_id": 0}}]
+
+        stats = manager.get_queue_stats()[session.client_id]
+        assert stats["conflated"] == 4
+        assert stats["dropped"] == 0
+        assert stats["depth"] == 0
+        assert stats["high_water"] == 1
+
+    def test_session_outbound_queue_keeps_responses(self):
+        manager = PerspectiveManager(max_queue_depth=1, queue_policy="drop_newest")
+        session = manager.new_session()
+        queue = session.outbound_queue()
+        manager.host_table("table1", Table(data))
+
+        session.process({"id": 1, "table_name": "table1", "view_name": "view1", "cmd": "view"}, queue)
+        session.process({"id": 2, "name": "view1", "cmd": "view_method", "subscribe": True, "method": "on_update", "callback_id": "callback_1"}, queue)
+        session.process({"id": 3, "table_name": "table1", "view_name": "view2", "cmd": "view"}, queue)
+        session.process({"id": 4, "name": "view2", "cmd": "view_method", "subscribe": True, "method": "on_update", "callback_id": "callback_2"}, queue)
+        manager.get_table("table1").update({"a": [4], "b": ["d"]})
+        session.process({"id": 5, "name": "view1", "cmd": "view_method", "method": "num_rows"}, queue)
+
+        # the second notification exceeds the depth and is dropped, but
+        # responses to the client's requests are always sent
+        messages = self._drain(queue)
+        assert [m["id"] for m in messages] == [2, 5]
+        assert messages[-1]["data"] == 4
+
+        stats = manager.get_queue_stats()[session.client_id]
+        assert stats["dropped"] == 1
+        assert stats["max_depth"] == 1
+
+    def test_session_outbound_queue_resyncs_dropped_deltas(self):
+        manager = PerspectiveManager(max_queue_depth=2, queue_policy="drop_oldest")
+        session = manager.new_session()
+        queue = session.outbound_queue()
+        manager.host_table("table1", Table(data))
+
+        session.process({"id": 1, "table_name": "table1", "view_name": "view1", "cmd": "view"}, queue)
+        session.process({"id": 2, "name": "view1", "cmd": "view_method", "subscribe": True, "method": "on_update", "callback_id": "callback_1", "args": [{"mode": "row"}]}, queue)
+        assert self._drain(queue) == []
+
+        table = manager.get_table("table1")
+        table.update({"a": [4], "b": ["d"]})
+        table.update({"a": [5], "b": ["e"]})
+
+        # the third delta overflows the queue - the pending deltas can no
+        # longer be applied in order, so they are replaced by a resync
+        # notification without a delta, which absorbs later updates.
+        table.update({"a": [6], "b": ["f"]})
+        table.update({"a": [7], "b": ["g"]})
+
+        frames = []
+        while True:
+            popped = queue.pop()
+            if popped is None:
+                break
+            frames.extend(popped)
+
+        assert [binary for _, binary in frames] == [False]
+        assert json.loads(frames[0][0]) == {"id": 2, "data": {"port_id": 0, "resync": True}}
+
+        stats = manager.get_queue_stats()[session.client_id]
+        assert stats["dropped"] == 1
+        assert stats["resynced"] == 1
+        assert stats["depth"] == 0
+
+        # once the resync is sent, deltas are delivered again
+        table.update({"a": [8], "b": ["h"]})
+        popped = queue.pop()
+        assert len(popped) == 2
+        assert json.loads(popped[0][0])["data"] == {"port_id": 0}
+        assert popped[1][1] is True
+        assert Table(popped[1][0]).view().to_dict() == {"a": [8], "b": ["h"]}
+
+    def test_session_outbound_queue_invalid_policy(self):
+        with raises(PerspectiveError):
+            PerspectiveManager(queue_policy="invalid")
+
+    def test_session_close_outbound_queue(self):
+        manager = PerspectiveManager()
+        session = manager.new_session()
+        session.outbound_queue()
+        assert session.client_id in manager.get_queue_stats()
+        session.close()
+        assert manager.get_queue_stats() == {}
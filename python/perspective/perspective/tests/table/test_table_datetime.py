@@ -5,12 +5,13 @@
 # This file is part of the Perspective library, distributed under the terms of
 # the Apache License 2.0.  The full license can be found in the LICENSE file.
 #
+import calendar
 import os
 import time
 import pytz
 import numpy as np
 import pandas as pd
-from datetime import date, datetime
+from datetime import date, datetime, timedelta
 from dateutil import tz
 from pytest import mark
 from perspective.table import Table
@@ -1616,6 +1617,38 @@ if os.name != 'nt':
             result = view.to_dict()
             assert result["computed"] == [datetime(2019, 1, 1)]
 
+        @mark.parametrize("zone", ["US/Eastern", "Europe/London", "Australia/Sydney"])
+        def test_table_hour_of_day_across_dst(self, zone):
+            """`hour_of_day` matches `localtime_r` every 15 minutes around
+            the 2020 transitions into and out of DST in the US, the UK and
+            Australia."""
+            os.environ["TZ"] = zone
+            time.tzset()
+
+            transitions = [
+                datetime(2020, 3, 8), datetime(2020, 11, 1),
+                datetime(2020, 3, 29), datetime(2020, 10, 25),
+                datetime(2020, 4, 5), datetime(2020, 10, 4)
+            ]
+            data = [
+                UTC.localize(d + timedelta(minutes=15 * i))
+                for d in transitions for i in range(-96, 96)
+            ]
+
+            computed_columns = [{
+                "inputs": ["a"],
+                "column": "computed",
+                "computed_function_name": "hour_of_day"
+            }]
+
+            table = Table({"a": data})
+            view = table.view(computed_columns=computed_columns)
+            expected = [
+                time.localtime(calendar.timegm(d.utctimetuple())).tm_hour
+                for d in data
+            ]
+            assert view.to_dict()["computed"] == expected
+
 
 class TestTableDateTimePivots(object):
 
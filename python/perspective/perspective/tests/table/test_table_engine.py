@@ -0,0 +1,261 @@
+# *****************************************************************************
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import threading
+import time
+from pytest import raises
+from perspective import PerspectiveCppError
+from perspective.table import Table
+from perspective.table.libbinding import t_batch_policy
+
+
+def _wait_for(predicate, timeout=5):
+    """Poll `predicate` until it returns True, as updates are processed
+    asynchronously on the engine thread."""
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        if predicate():
+            return True
+        time.sleep(0.01)
+    return predicate()
+
+
+class TestTableEngine(object):
+
+    def test_table_engine_processes_updates(self):
+        tbl = Table({"a": [1, 2, 3]})
+        tbl.start_engine(0)
+        try:
+            tbl.update({"a": [4, 5]})
+            assert _wait_for(lambda: tbl.size() == 5)
+        finally:
+            tbl.stop_engine()
+        assert tbl.view().to_dict() == {"a": [1, 2, 3, 4, 5]}
+
+    def test_table_engine_is_running(self):
+        tbl = Table({"a": [1, 2, 3]})
+        assert tbl.is_engine_running() is False
+        tbl.start_engine()
+        assert tbl.is_engine_running() is True
+        tbl.stop_engine()
+        assert tbl.is_engine_running() is False
+
+    def test_table_engine_stopped_on_delete(self):
+        tbl = Table({"a": [1, 2, 3]})
+        tbl.start_engine(60000)
+        tbl.update({"a": [4]})
+        tbl.delete()
+        assert tbl.is_engine_running() is False
+
+    def test_table_engine_stop_flushes_queue(self):
+        tbl = Table({"a": [1, 2, 3]})
+        view = tbl.view()
+
+        # A cadence long enough that nothing is processed before `stop`
+        tbl.start_engine(60000)
+        for i in range(10):
+            tbl.update({"a": [i]})
+        tbl.stop_engine()
+
+        assert tbl.size() == 13
+        assert view.num_rows() == 13
+
+    def test_table_engine_coalesces_fragments(self):
+        tbl = Table({"a": [1, 2, 3]})
+        view = tbl.view()
+        calls = []
+        view.on_update(lambda port_id: calls.append(port_id))
+
+        tbl.start_engine(60000)
+        for i in range(10):
+            tbl.update({"a": [i]})
+        tbl.stop_engine()
+
+        # Every queued fragment reaches the port, which is processed once.
+        assert calls == [0]
+        assert view.num_rows() == 13
+
+    def test_table_engine_notifies_on_engine_thread(self):
+        tbl = Table({"a": [1, 2, 3]})
+        view = tbl.view()
+        threads = []
+        view.on_update(lambda port_id: threads.append(threading.get_ident()))
+        tbl.start_engine(0)
+        try:
+            tbl.update({"a": [4]})
+            assert _wait_for(lambda: len(threads) == 1)
+        finally:
+            tbl.stop_engine()
+        assert threads[0] != threading.get_ident()
+
+    def test_table_engine_update_callback_reads_view(self):
+        tbl = Table({"a": [1, 2, 3]}, index="a")
+        view = tbl.view()
+        deltas = []
+        view.on_update(lambda port_id, delta: deltas.append(delta), mode="row")
+        tbl.start_engine(0)
+        try:
+            tbl.update({"a": [4]})
+            assert _wait_for(lambda: len(deltas) == 1)
+        finally:
+            tbl.stop_engine()
+        assert Table(deltas[0]).view().to_dict() == {"a": [4]}
+
+    def test_table_engine_concurrent_reads(self):
+        tbl = Table({"a": [0], "b": ["x"]})
+        flat = tbl.view()
+        pivoted = tbl.view(row_pivots=["b"], columns=["a"])
+        tbl.start_engine(1)
+
+        def write():
+            for i in range(1, 201):
+                tbl.update({"a": [i], "b": ["x" if i % 2 else "y"]})
+
+        writer = threading.Thread(target=write)
+        writer.start()
+        try:
+            while writer.is_alive():
+                records = flat.to_records()
+                assert all(row["a"] is not None for row in records)
+                pivoted.to_arrow()
+                pivoted.num_rows()
+                flat.memory_usage()
+                tbl.memory_usage()
+        finally:
+            writer.join()
+            tbl.stop_engine()
+
+        assert flat.num_rows() == 201
+        assert pivoted.to_dict()["a"][0] == sum(range(201))
+
+    def test_table_engine_view_created_while_running(self):
+        tbl = Table({"a": [0], "b": ["x"]})
+        tbl.start_engine(1)
+
+        def write():
+            for i in range(1, 101):
+                tbl.update({"a": [i], "b": ["x" if i % 2 else "y"]})
+
+        writer = threading.Thread(target=write)
+        writer.start()
+        views = []
+        try:
+            while writer.is_alive():
+                view = tbl.view(row_pivots=["b"], columns=["a"])
+                view.to_records()
+                views.append(view)
+        finally:
+            writer.join()
+            tbl.stop_engine()
+
+        for view in views:
+            assert view.to_dict()["a"][0] == sum(range(101))
+
+    # batching
+
+    def test_table_batch_policy_requires_engine(self):
+        tbl = Table({"a": [1, 2, 3]})
+        pool = tbl._table.get_pool()
+        policy = t_batch_policy()
+        policy.max_latency_ms = 100
+        with raises(PerspectiveCppError) as ex:
+            pool.set_batch_policy(tbl._gnode_id, policy)
+        assert "start_engine" in str(ex.value)
+
+    def test_table_batch_stats_without_engine(self):
+        tbl = Table({"a": [1, 2, 3]})
+        pool = tbl._table.get_pool()
+        tbl.update({"a": [4, 5]})
+        tbl.update({"a": [6]})
+        stats = pool.get_batch_stats(tbl._gnode_id)
+        assert stats.num_batches == 3
+        assert stats.num_rows == 6
+        assert stats.last_rows == 1
+        assert stats.max_rows == 3
+
+    def test_table_batch_rows_metric(self):
+        tbl = Table({"a": [1, 2, 3]})
+        metrics = tbl._table.get_pool().get_metrics()
+        metrics.set_enabled(True)
+        tbl.update({"a": [4, 5]})
+        tbl.update({"a": [6]})
+        histogram = metrics.get_histograms()["gnode.{}.batch_rows".format(tbl._gnode_id)]
+        assert histogram.count == 2
+        assert histogram.max == 2
+
+    def test_table_batch_policy_max_rows(self):
+        tbl = Table({"a": [1, 2, 3]})
+        pool = tbl._table.get_pool()
+        metrics = pool.get_metrics()
+        metrics.set_enabled(True)
+        tbl.start_engine(0)
+        try:
+            policy = t_batch_policy()
+            policy.max_latency_ms = 60000
+            policy.max_rows = 5
+            pool.set_batch_policy(tbl._gnode_id, policy)
+
+            for i in range(4):
+                tbl.update({"a": [i]})
+
+            # The batch is held back until it holds `max_rows` rows
+            time.sleep(0.1)
+            assert tbl.size() == 3
+
+            tbl.update({"a": [4]})
+            assert _wait_for(lambda: tbl.size() == 8)
+        finally:
+            tbl.stop_engine()
+
+        stats = pool.get_batch_stats(tbl._gnode_id)
+        assert stats.num_batches == 2
+        assert stats.last_rows == 5
+        assert stats.num_rows == 8
+        histogram = metrics.get_histograms()["gnode.{}.batch_rows".format(tbl._gnode_id)]
+        assert histogram.count == 1
+        assert histogram.max == 5
+
+    def test_table_batch_policy_max_latency(self):
+        tbl = Table({"a": [1, 2, 3]})
+        pool = tbl._table.get_pool()
+        tbl.start_engine(0)
+        try:
+            policy = t_batch_policy()
+            policy.max_latency_ms = 100
+            pool.set_batch_policy(tbl._gnode_id, policy)
+            tbl.update({"a": [4]})
+            assert tbl.size() == 3
+            assert _wait_for(lambda: tbl.size() == 4)
+        finally:
+            tbl.stop_engine()
+
+        stats = pool.get_batch_stats(tbl._gnode_id)
+        assert stats.num_batches == 2
+        assert stats.last_rows == 1
+        assert stats.last_latency_ms >= 90
+        assert stats.max_latency_ms == stats.last_latency_ms
+
+    def test_table_batch_policy_flushed_on_stop(self):
+        tbl = Table({"a": [1, 2, 3]})
+        pool = tbl._table.get_pool()
+        tbl.start_engine(0)
+        policy = t_batch_policy()
+        policy.max_latency_ms = 60000
+        pool.set_batch_policy(tbl._gnode_id, policy)
+        tbl.update({"a": [4]})
+        tbl.update({"a": [5]})
+        tbl.stop_engine()
+
+        assert tbl.size() == 5
+        stats = pool.get_batch_stats(tbl._gnode_id)
+        assert stats.num_batches == 2
+        assert stats.last_rows == 2
+
+        # Without the engine, `_process` ignores the policy set before `stop`
+        tbl.update({"a": [6]})
+        assert tbl.size() == 6
@@ -152,11 +152,26 @@ class TestTableInfer(object):
         tbl = Table(data)
         assert tbl.schema() == {"a": datetime}
 
+    def test_table_infer_rfc2822_datetime(self):
+        data = {"a": [None, None, None, None, None, "Thu, 25 Jul 2019 09:00:00 +0000"]}
+        tbl = Table(data)
+        assert tbl.schema() == {"a": datetime}
+
+    def test_table_infer_rfc2822_date(self):
+        data = {"a": [None, None, None, None, None, "25 Jul 2019"]}
+        tbl = Table(data)
+        assert tbl.schema() == {"a": date}
+
     def test_table_infer_invalid_datetime(self):
         data = {"a": [None, None, None, None, None, None, "08/31/2019 25:30:00"]}
         tbl = Table(data)
         assert tbl.schema() == {"a": str}
 
+    def test_table_infer_leap_second(self):
+        data = {"a": [None, None, None, None, None, None, "2016-12-31T23:59:60"]}
+        tbl = Table(data)
+        assert tbl.schema() == {"a": str}
+
     def test_table_infer_mixed_date(self):
         data = {"a": [None, None, None, None, None, "08/11/2019"]}
         tbl = Table(data)
@@ -0,0 +1,113 @@
+# *****************************************************************************
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import calendar
+import json
+import os
+import time
+from datetime import date, datetime
+from perspective.table import Table
+
+
+class TestTableJSON(object):
+
+    def test_table_json_records(self):
+        data = [{"a": 1, "b": "x"}, {"a": 2, "b": "y"}]
+        tbl = Table(json.dumps(data))
+        assert tbl.size() == 2
+        assert tbl.schema() == {"a": int, "b": str}
+        assert tbl.view().to_records() == data
+
+    def test_table_json_columns(self):
+        data = {"a": [1.5, 2.5, 3.5], "b": [True, False, True]}
+        tbl = Table(json.dumps(data))
+        assert tbl.size() == 3
+        assert tbl.schema() == {"a": float, "b": bool}
+        assert tbl.view().to_columns() == data
+
+    def test_table_json_ndjson(self):
+        data = [{"a": 1, "b": "x"}, {"a": 2, "b": "y"}, {"a": 3, "b": "z"}]
+        tbl = Table("\n".join(json.dumps(row) for row in data))
+        assert tbl.size() == 3
+        assert tbl.view().to_records() == data
+
+    def test_table_json_infers_int_then_float(self):
+        tbl = Table(json.dumps({"a": [1, 2, 3.5]}))
+        assert tbl.schema() == {"a": float}
+        assert tbl.view().to_columns() == {"a": [1.0, 2.0, 3.5]}
+
+    def test_table_json_nulls_and_missing_keys(self):
+        tbl = Table(json.dumps([{"a": 1, "b": "x"}, {"a": None}, {"b": "z"}]))
+        assert tbl.size() == 3
+        assert tbl.view().to_columns() == {"a": [1, None, None], "b": ["x", None, "z"]}
+
+    def test_table_json_dates(self):
+        data = {
+            "a": ["2020-01-01", "2020-02-29"],
+            "b": ["2020-01-01T12:30:00Z", "2020-01-02 00:00:00"]
+        }
+        tbl = Table(json.dumps(data))
+        assert tbl.schema() == {"a": date, "b": datetime}
+        result = tbl.view().to_columns()
+        assert result["a"] == [datetime(2020, 1, 1), datetime(2020, 2, 29)]
+
+        # `Z` is UTC, and naive datetimes are in local time.
+        utc = datetime.fromtimestamp(calendar.timegm((2020, 1, 1, 12, 30, 0)))
+        assert result["b"] == [utc, datetime(2020, 1, 2)]
+
+    def test_table_json_dates_tz_offset(self):
+        data = {"a": ["2020-01-01T12:30:00+05:30", "2020-01-01T12:30:00+0530", "2020-01-01T12:30:00-05"]}
+        tbl = Table(json.dumps(data))
+        assert tbl.schema() == {"a": datetime}
+        utc = [
+            datetime.fromtimestamp(calendar.timegm((2020, 1, 1, 7, 0, 0))),
+            datetime.fromtimestamp(calendar.timegm((2020, 1, 1, 7, 0, 0))),
+            datetime.fromtimestamp(calendar.timegm((2020, 1, 1, 17, 30, 0))),
+        ]
+        assert tbl.view().to_columns()["a"] == utc
+
+    def test_table_json_dates_invalid_tz_offset(self):
+        # A `:` must be followed by two minute digits, and offsets are at
+        # most 23:59.
+        for offset in ("+05:", "+05:3", "+99:99", "+24:00", "-05:60"):
+            tbl = Table(json.dumps({"a": ["2020-01-01T12:30:00" + offset]}))
+            assert tbl.schema() == {"a": str}
+
+    if os.name != 'nt':
+        # no tzset on windows
+
+        def test_table_json_dates_local_time(self):
+            os.environ["TZ"] = "US/Eastern"
+            time.tzset()
+            try:
+                data = {
+                    "a": ["2020-01-01T12:30:00Z", "2020-07-01T12:30:00Z"],
+                    "b": ["2020-01-01 12:30:00", "2020-07-01 12:30:00"]
+                }
+                tbl = Table(json.dumps(data))
+                result = tbl.view().to_columns()
+                assert result["a"] == [datetime(2020, 1, 1, 7, 30), datetime(2020, 7, 1, 8, 30)]
+                assert result["b"] == [datetime(2020, 1, 1, 12, 30), datetime(2020, 7, 1, 12, 30)]
+            finally:
+                os.environ["TZ"] = "UTC"
+                time.tzset()
+
+    def test_table_json_update(self):
+        tbl = Table({"a": [1, 2, 3], "b": ["x", "y", "z"]}, index="a")
+        tbl.update(json.dumps([{"a": 2, "b": "w"}, {"a": 4, "b": "v"}]))
+        assert tbl.view().to_columns() == {"a": [1, 2, 3, 4], "b": ["x", "w", "z", "v"]}
+
+    def test_table_json_update_converts_to_schema(self):
+        tbl = Table({"a": int, "b": float, "c": str})
+        tbl.update(json.dumps({"a": ["1", "2"], "b": [1, 2], "c": [1, True]}))
+        assert tbl.view().to_columns() == {"a": [1, 2], "b": [1.0, 2.0], "c": ["1", "true"]}
+
+    def test_table_json_update_ndjson(self):
+        tbl = Table({"a": int, "b": str}, index="a")
+        tbl.update('{"a": 1, "b": "x"}\n{"a": 2, "b": "y"}\n{"a": 1, "b": "z"}\n')
+        assert tbl.view().to_records() == [{"a": 1, "b": "z"}, {"a": 2, "b": "y"}]
@@ -0,0 +1,94 @@
+# *****************************************************************************
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+from perspective.table import Table
+from perspective.table.libbinding import t_shrink_policy
+
+
+class TestTableMemoryUsage(object):
+
+    def test_table_memory_usage_categories(self):
+        tbl = Table({"a": [1, 2, 3], "b": ["x", "y", "z"]})
+        usage = tbl.memory_usage()
+        assert set(usage.keys()) == set(["master_table", "mapping", "input_ports", "transitional_tables"])
+        assert usage["master_table"] > 0
+
+    def test_table_memory_usage_grows_with_data(self):
+        tbl = Table({"a": int, "b": str})
+        before = tbl.memory_usage()["master_table"]
+        tbl.update({"a": list(range(10000)), "b": [str(i) for i in range(10000)]})
+        after = tbl.memory_usage()["master_table"]
+        assert after > before
+
+    def test_view_memory_usage_zero_sided(self):
+        tbl = Table({"a": [1, 2, 3]})
+        view = tbl.view(sort=[["a", "desc"]])
+        usage = view.memory_usage()
+        assert usage["traversal"] > 0
+        assert "tree" not in usage
+
+    def test_view_memory_usage_shared_context(self):
+        tbl = Table({"a": list(range(1000))})
+        view = tbl.view(sort=[["a", "desc"]])
+        alone = view.memory_usage()["traversal"]
+        view2 = tbl.view(sort=[["a", "desc"]])
+        assert len(tbl._table.get_gnode().get_registered_contexts()) == 1
+
+        # each view is attributed half of the shared context
+        shared = view.memory_usage()["traversal"]
+        assert shared == view2.memory_usage()["traversal"]
+        assert shared == alone // 2
+
+    def test_view_memory_usage_processes_updates(self):
+        tbl = Table({"a": [1, 2, 3]})
+        view = tbl.view(sort=[["a", "desc"]])
+        before = view.memory_usage()["traversal"]
+        tbl.update({"a": list(range(10000))})
+        assert view.memory_usage()["traversal"] > before
+
+    def test_view_memory_usage_pivoted(self):
+        tbl = Table({"a": [1, 2, 3], "b": ["x", "y", "x"]})
+        view = tbl.view(row_pivots=["b"], column_pivots=["a"])
+        usage = view.memory_usage()
+        for category in ("tree", "aggregates", "traversal", "deltas", "symtable"):
+            assert category in usage
+        assert usage["tree"] > 0
+        assert usage["aggregates"] > 0
+
+    def test_table_transitional_tables_shrink_after_spike(self):
+        tbl = Table({"a": int})
+        tbl.update({"a": [0]})
+        policy = t_shrink_policy()
+        policy.min_updates = 2
+        policy.min_rows = 8
+        tbl._table.get_pool().set_shrink_policy(tbl._table.get_gnode().get_id(), policy)
+
+        tbl.update({"a": list(range(100000))})
+        spike = tbl.memory_usage()["transitional_tables"]
+
+        for i in range(3):
+            tbl.update({"a": [i]})
+        after = tbl.memory_usage()["transitional_tables"]
+        assert after * 100 < spike
+        assert tbl.size() == 100004
+
+    def test_table_transitional_tables_kept_without_shrink(self):
+        tbl = Table({"a": int})
+        tbl.update({"a": [0]})
+        policy = t_shrink_policy()
+        policy.min_updates = 0
+        tbl._table.get_pool().set_shrink_policy(tbl._table.get_gnode().get_id(), policy)
+
+        tbl.update({"a": list(range(100000))})
+        spike = tbl.memory_usage()["transitional_tables"]
+
+        for i in range(3):
+            tbl.update({"a": [i]})
+
+        # Only the flattened port, which is replaced on every update, shrinks
+        assert tbl.memory_usage()["transitional_tables"] * 2 > spike
@@ -0,0 +1,101 @@
+# *****************************************************************************
+#
+# Copyright (c) 2019, the Perspective Authors.
+#
+# This file is part of the Perspective library, distributed under the terms of
+# the Apache License 2.0.  The full license can be found in the LICENSE file.
+#
+
+import json
+import os
+import threading
+from perspective.table import Table
+
+
+class TestTableMetrics(object):
+
+    def test_table_metrics_disabled_by_default(self):
+        tbl = Table({"a": [1, 2, 3]})
+        metrics = tbl._table.get_pool().get_metrics()
+        assert metrics.is_enabled() is False
+        tbl.update({"a": [4]})
+        assert tbl.size() == 4
+        assert metrics.get_counters() == {}
+        assert metrics.get_histograms() == {}
+
+    def test_table_metrics_records_stages(self):
+        tbl = Table({"a": [1, 2, 3]}, index="a")
+        view = tbl.view(row_pivots=["a"])
+        metrics = tbl._table.get_pool().get_metrics()
+        metrics.set_enabled(True)
+        tbl.update({"a": [2, 4]})
+        view.to_records()
+
+        counters = metrics.get_counters()
+        histograms = metrics.get_histograms()
+        assert counters["gnode.0.rows"] == 2
+        for stage in ("flatten", "lookup", "process_columns", "update_master_table", "notify_contexts"):
+            assert histograms["gnode.0." + stage].count == 1
+
+        notify = [name for name in histograms if name.startswith("gnode.0.ctx.") and name.endswith(".notify")]
+        assert len(notify) == 1
+
+        summary = json.loads(metrics.to_json())
+        assert summary["counters"]["gnode.0.rows"] == 2
+
+    def test_table_metrics_chrome_trace(self):
+        tbl = Table({"a": [1, 2, 3]})
+        metrics = tbl._table.get_pool().get_metrics()
+        metrics.set_tracing(True)
+        tbl.update({"a": [4]})
+        assert tbl.size() == 4
+        trace = json.loads(metrics.to_chrome_trace())
+        names = set(event["name"] for event in trace["traceEvents"])
+        assert "gnode.0.flatten" in names
+        assert all(event["ph"] == "X" for event in trace["traceEvents"])
+
+        metrics.reset()
+        assert json.loads(metrics.to_chrome_trace()) == {"traceEvents": []}
+
+    def test_table_metrics_durations_nonzero(self):
+        tbl = Table({"a": [1, 2, 3]})
+        metrics = tbl._table.get_pool().get_metrics()
+        metrics.set_tracing(True)
+        tbl.update({"a": [4]})
+        assert tbl.size() == 4
+
+        # Timers use a monotonic clock on every platform.
+        assert metrics.get_histograms()["gnode.0.process_table"].max > 0
+        trace = json.loads(metrics.to_chrome_trace())
+        assert any(event["dur"] > 0 for event in trace["traceEvents"])
+
+    def test_table_metrics_compute_columns_recorded_once(self):
+        tbl = Table({"a": [1, 2, 3]}, index="a")
+        metrics = tbl._table.get_pool().get_metrics()
+        metrics.set_enabled(True)
+        tbl.update({"a": [2, 4]})
+        assert tbl.size() == 4
+        assert metrics.get_histograms()["gnode.0.compute_columns"].count == 1
+
+    def test_table_metrics_resident_mb(self):
+        tbl = Table({"a": [1, 2, 3]})
+        metrics = tbl._table.get_pool().get_metrics()
+        metrics.set_enabled(True)
+        tbl.update({"a": [4]})
+        assert tbl.size() == 4
+
+        # A Python process with perspective loaded is more than 1MB, and far
+        # less than 1TB, whichever unit `psp_curmem` uses natively.
+        resident_mb = metrics.get_counters()["pool.resident_mb"]
+        assert 1 < resident_mb < 1024 * 1024
+
+    if hasattr(threading, "get_native_id") and os.name != "nt":
+        def test_table_metrics_chrome_trace_thread_id(self):
+            tbl = Table({"a": [1, 2, 3]})
+            metrics = tbl._table.get_pool().get_metrics()
+            metrics.set_tracing(True)
+            tbl.update({"a": [4]})
+            assert tbl.size() == 4
+            trace = json.loads(metrics.to_chrome_trace())
+            assert len(trace["traceEvents"]) > 0
+            assert all(event["tid"] == threading.get_native_id() for event in trace["traceEvents"])
@@ -651,6 +651,53 @@ class TestToFormat(object):
             {'2|a': None, '2|b': None, '4|a': 3, '4|b': 4, '__ROW_PATH__': [3]}
         ]
 
+    def test_to_records_one_start_col_window(self):
+        data = [{"a": 1, "b": 2, "c": 3}, {"a": 3, "b": 4, "c": 5}]
+        tbl = Table(data)
+        view = tbl.view(
+            row_pivots=["a"]
+        )
+        records = view.to_records(
+            start_col=1,
+            end_col=2
+        )
+        assert records == [
+            {'__ROW_PATH__': [], 'b': 6},
+            {'__ROW_PATH__': [1], 'b': 2},
+            {'__ROW_PATH__': [3], 'b': 4}
+        ]
+
+    def test_to_records_two_sorted_col_window(self):
+        data = [{"a": 1, "b": 2}, {"a": 3, "b": 4}]
+        tbl = Table(data)
+        view = tbl.view(
+            row_pivots=["a"],
+            column_pivots=["b"],
+            sort=[["a", "desc"]]
+        )
+        full = view.to_records()
+        records = view.to_records(
+            start_col=1,
+            end_col=3
+        )
+        assert records == [
+            {k: row[k] for k in ("__ROW_PATH__", "2|b", "4|a")} for row in full
+        ]
+
+    def test_to_records_two_sorted_columns_after_update(self):
+        data = [{"a": 1, "b": 2}, {"a": 3, "b": 4}]
+        tbl = Table(data)
+        view = tbl.view(
+            row_pivots=["a"],
+            column_pivots=["b"],
+            sort=[["a", "desc"]]
+        )
+        assert list(view.to_records()[0].keys()) == ["__ROW_PATH__", "2|a", "2|b", "4|a", "4|b"]
+        tbl.update([{"a": 5, "b": 6}])
+        records = view.to_records()
+        assert list(records[0].keys()) == ["__ROW_PATH__", "2|a", "2|b", "4|a", "4|b", "6|a", "6|b"]
+        assert records[1] == {"__ROW_PATH__": [5], "2|a": None, "2|b": None, "4|a": None, "4|b": None, "6|a": 5, "6|b": 6}
+
     def test_to_records_two_start_gt_end_col(self):
         data = [{"a": 1, "b": 2}, {"a": 3, "b": 4}]
         tbl = Table(data)
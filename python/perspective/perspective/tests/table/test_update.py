@@ -52,6 +52,16 @@ class TestUpdate(object):
         tbl.update([{"a": "abc"}, {"a": "def", "c": None}])
         assert tbl.view().to_records() == [{"a": "abc", "b": 1, "c": 2}, {"a": "def", "b": 3, "c": None}]
 
+    def test_update_partial_unset_str_all_null(self):
+        tbl = Table([{"a": "abc", "b": "x"}, {"a": "def", "b": "y"}], index="a")
+        tbl.update([{"a": "abc", "b": None}, {"a": "def", "b": None}])
+        assert tbl.view().to_records() == [{"a": "abc", "b": None}, {"a": "def", "b": None}]
+
+    def test_update_str_all_null(self):
+        tbl = Table({"a": ["x", "y"]})
+        tbl.update({"a": [None, None]})
+        assert tbl.view().to_dict() == {"a": ["x", "y", None, None]}
+
     def test_update_columnar_partial_add_row(self):
         tbl = Table([{"a": "abc", "b": 123}], index="a")
 
@@ -232,6 +242,20 @@ class TestUpdate(object):
             {"a": datetime(2019, 7, 12)}
         ]
 
+    def test_update_date_str(self):
+        tbl = Table({"a": [date(2019, 7, 11)]})
+        tbl.update([{"a": "2019/07/12"}, {"a": "07/13/2019"}, {"a": "14 Jul 2019"}, {"a": "July 15, 2019"}])
+        assert tbl.view().to_dict() == {
+            "a": [datetime(2019, 7, day) for day in range(11, 16)]
+        }
+
+    def test_update_datetime_str(self):
+        tbl = Table({"a": [datetime(2019, 7, 11, 11, 0)]})
+        tbl.update({"a": ["2019-07-12 11:00:00", "07/13/2019 11:00", "July 14, 2019 11:00", "not a date", None]})
+        assert tbl.view().to_dict() == {
+            "a": [datetime(2019, 7, day, 11, 0) for day in range(11, 15)] + [None, None]
+        }
+
     def test_update_date_np(self):
         tbl = Table({"a": [date(2019, 7, 11)]})
         tbl.update([{"a": np.datetime64(date(2019, 7, 12))}])
@@ -1207,3 +1207,30 @@ class TestUpdateArrow(object):
             tbl.update(update_arrow)
 
         assert tbl.size() == 3
+
+    def test_update_arrow_after_source_released(self, util):
+        names = ["a", "b", "c"]
+        types = [pa.int64(), pa.float64(), pa.timestamp("ms")]
+        arrow = util.make_arrow(names, [
+            [1, 2, 3],
+            [1.5, 2.5, 3.5],
+            [datetime(2020, 1, 1), datetime(2020, 1, 2), datetime(2020, 1, 3)]
+        ], types=types)
+
+        # fixed width columns point into the loaded binary, so they must
+        # outlive the binding's copy of it
+        tbl = Table(arrow)
+        view = tbl.view()
+        del arrow
+
+        # reuse the memory of released binaries before the table is read
+        for i in range(10):
+            Table(util.make_arrow(names, [[-1] * 3, [-1.0] * 3, [datetime(2000, 1, 1)] * 3], types=types))
+
+        tbl.update(util.make_arrow(names, [[4], [4.5], [datetime(2020, 1, 4)]], types=types))
+
+        assert view.to_dict() == {
+            "a": [1, 2, 3, 4],
+            "b": [1.5, 2.5, 3.5, 4.5],
+            "c": [datetime(2020, 1, i) for i in range(1, 5)]
+        }
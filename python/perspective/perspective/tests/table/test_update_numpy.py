@@ -31,6 +31,23 @@ class TestUpdateNumpy(object):
             "b": [2, 3, 4, 5, None, None, None, None]
         }
 
+    def test_update_np_cast_numeric(self):
+        tbl = Table({
+            "a": [1, 2],
+            "b": [1.5, 2.5],
+            "c": [True, False]
+        })
+        tbl.update({
+            "a": np.array([3.7, np.nan]),
+            "b": np.array([3, 4]),
+            "c": np.array([False, True])
+        })
+        assert tbl.view().to_dict() == {
+            "a": [1, 2, 3, None],
+            "b": [1.5, 2.5, 3, 4],
+            "c": [True, False, False, True]
+        }
+
     def test_update_np_bool_str(self):
         tbl = Table({
             "a": [True]
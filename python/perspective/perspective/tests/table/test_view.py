@@ -611,6 +611,113 @@ class TestView(object):
             "x": [None, 3, 4, 4, 3, 2, 1, 1, 2]
         }
 
+    # flat sorts, which must order rows exactly as `cmp_mselem` does
+
+    def test_view_sort_flat_nan_placement(self):
+        tbl = Table({"k": ["a", "b", "c", "d"], "x": [1.5, None, -2.0, 0.5]})
+
+        # NaN is only stored as-is on update
+        tbl.update({"k": ["e", "f", "g"], "x": [float("nan"), 3.0, float("nan")]})
+        asc = tbl.view(columns=["k"], sort=[["x", "asc"]])
+        desc = tbl.view(columns=["k"], sort=[["x", "desc"]])
+
+        # NaN sorts below nulls ascending and last descending, and NaNs
+        # keep the order of their primary keys.
+        assert asc.to_dict() == {"k": ["e", "g", "b", "c", "d", "a", "f"]}
+        assert desc.to_dict() == {"k": ["f", "a", "d", "c", "b", "e", "g"]}
+
+    def test_view_sort_flat_abs(self):
+        tbl = Table({"x": [-3, 1, -1, None, 2, 0, 3]})
+
+        # Equal absolute values, and nulls against 0, are ordered by
+        # primary key - ascending for "asc abs", descending for "desc abs".
+        asc = tbl.view(sort=[["x", "asc abs"]])
+        assert asc.to_dict() == {"x": [None, 0, 1, -1, 2, -3, 3]}
+        desc = tbl.view(sort=[["x", "desc abs"]])
+        assert desc.to_dict() == {"x": [3, -3, 2, -1, 1, 0, None]}
+
+    def test_view_sort_flat_abs_ignores_later_sorts(self):
+        tbl = Table({"x": [-1, 1, 2, -2], "y": ["a", "z", "a", "b"]})
+
+        # The primary key breaks ties in an absolute sort before any later
+        # sort column is compared.
+        view = tbl.view(sort=[["x", "desc abs"], ["y", "asc"]])
+        assert view.to_dict() == {"x": [-2, 2, 1, -1], "y": ["b", "a", "z", "a"]}
+
+    def test_view_sort_flat_nulls(self):
+        tbl = Table({
+            "s": ["b", None, "a", "c", None],
+            "d": [date(2020, 1, 2), None, date(2020, 1, 1), date(2020, 1, 3), None],
+            "f": [0.5, None, -0.5, 1.5, None],
+        })
+
+        # Nulls sort first ascending and last descending, in primary key order
+        for column in ("s", "d", "f"):
+            asc = tbl.view(columns=["s"], sort=[[column, "asc"]])
+            assert asc.to_dict() == {"s": [None, None, "a", "b", "c"]}
+            desc = tbl.view(columns=["s"], sort=[[column, "desc"]])
+            assert desc.to_dict() == {"s": ["c", "b", "a", None, None]}
+
+    def test_view_sort_flat_mixed_types(self):
+        tbl = Table({
+            "s": ["b", "a", "b", "a", "b", "a"],
+            "i": [1, 2, 1, 1, 2, None],
+            "f": [0.5, 1.5, -0.5, 2.5, 0.5, 1.0],
+            "b": [True, False, True, False, False, True],
+            "k": [0, 1, 2, 3, 4, 5],
+        })
+        view = tbl.view(columns=["k"], sort=[["s", "asc"], ["i", "desc"], ["f", "asc"]])
+        assert view.to_dict() == {"k": [1, 3, 5, 4, 2, 0]}
+        view = tbl.view(columns=["k"], sort=[["b", "desc"], ["f", "desc"]])
+        assert view.to_dict() == {"k": [5, 0, 2, 3, 1, 4]}
+
+    def test_view_sort_flat_matches_incremental(self):
+        data = {
+            "x": [1.5, None, -2.0, 0.5, -1.5, 2.0],
+            "s": ["b", "a", None, "a", "b", "c"],
+        }
+        sort = [["s", "desc"], ["x", "asc abs"]]
+        tbl = Table({"x": float, "s": str})
+        incremental = tbl.view(sort=sort)
+        for idx in range(6):
+            tbl.update({"x": [data["x"][idx]], "s": [data["s"][idx]]})
+
+        # A view sorted from scratch orders rows as the one sorted as they
+        # were inserted.
+        assert tbl.view(sort=sort).to_dict() == incremental.to_dict()
+
+    def test_view_value_count_aggregates_after_update(self):
+        data = {
+            "i": [0, 1, 2, 3, 4, 5],
+            "g": ["a", "a", "b", "b", "c", "c"],
+            "x": ["p", "q", "p", "p", "q", "r"],
+            "y": [True, True, False, True, True, True],
+            "z": [1, 1, 2, 3, 3, 3]
+        }
+        aggregates = {
+            "x": "join",
+            "y": "and",
+            "z": "dominant",
+            "i": "unique"
+        }
+        tbl = Table(data, index="i")
+        view = tbl.view(row_pivots=["g"], columns=["x", "y", "z", "i"], aggregates=aggregates)
+
+        tbl.update({
+            "i": [2, 4, 6],
+            "g": ["a", "a", "b"],
+            "x": ["s", "q", "s"],
+            "y": [True, False, True],
+            "z": [1, 2, 2]
+        })
+        tbl.update({"i": [0, 3], "x": ["r", "p"], "z": [2, 2]})
+        tbl.remove([5, 1])
+
+        expected = Table(tbl.view().to_dict(), index="i").view(
+            row_pivots=["g"], columns=["x", "y", "z", "i"], aggregates=aggregates)
+        assert view.to_dict() == expected.to_dict()
+        assert view.to_dict()["x"][1] == "q, r, s, "
+
     # filter
 
     def test_view_filter_int_eq(self):
@@ -1359,6 +1466,129 @@ class TestView(object):
         view.on_update(cb1, mode="row")
         tbl.update(data)
 
+    # row delta cache
+
+    def test_view_row_delta_same_epoch_returns_same_bytes(self):
+        deltas = []
+
+        def cb1(port_id, delta):
+            deltas.append(delta)
+            deltas.append(view._get_row_delta())
+
+        tbl = Table({"a": [1, 3], "b": [2, 4]})
+        view = tbl.view(row_pivots=["a"])
+        view.on_update(cb1, mode="row")
+        tbl.update({"a": [5], "b": [6]})
+
+        # reading the delta clears the tree's deltas, so the second read
+        # must come from the cache
+        assert len(deltas) == 2
+        assert deltas[0] == deltas[1]
+        compare_delta(deltas[1], {"a": [9, 5], "b": [12, 6]})
+
+    def test_view_row_delta_update_invalidates_cache(self):
+        deltas = []
+
+        def cb1(port_id, delta):
+            deltas.append(delta)
+
+        tbl = Table({"a": [1, 3], "b": [2, 4]})
+        view = tbl.view()
+        view.on_update(cb1, mode="row")
+        tbl.update({"a": [5], "b": [6]})
+        tbl.update({"a": [7], "b": [8]})
+
+        assert len(deltas) == 2
+        assert deltas[0] != deltas[1]
+        compare_delta(deltas[0], {"a": [5], "b": [6]})
+        compare_delta(deltas[1], {"a": [7], "b": [8]})
+
+    def test_view_row_delta_not_shared_between_views(self):
+        deltas = {}
+
+        def make_callback(name):
+            def callback(port_id, delta):
+                deltas[name] = delta
+            return callback
+
+        tbl = Table({"a": [1, 3], "b": [2, 4]})
+        view = tbl.view(sort=[["a", "desc"]])
+        view2 = tbl.view(sort=[["a", "desc"]])
+        view3 = tbl.view(sort=[["a", "desc"]], columns=["b"])
+        view.on_update(make_callback("view"), mode="row")
+        view2.on_update(make_callback("view2"), mode="row")
+        view3.on_update(make_callback("view3"), mode="row")
+        tbl.update({"a": [5], "b": [6]})
+
+        # `view` and `view2` share a context, but each serializes its own
+        # delta from it
+        compare_delta(deltas["view"], {"a": [5], "b": [6]})
+        compare_delta(deltas["view2"], {"a": [5], "b": [6]})
+        compare_delta(deltas["view3"], {"b": [6]})
+
+    # shared contexts
+
+    def test_view_shares_context_with_same_config(self):
+        tbl = Table({"a": [1, 2, 3], "b": ["x", "y", "z"]})
+        view = tbl.view(sort=[["a", "desc"]])
+        view2 = tbl.view(sort=[["a", "desc"]])
+        assert len(tbl._table.get_gnode().get_registered_contexts()) == 1
+        tbl.update({"a": [4], "b": ["w"]})
+        assert view.to_dict() == view2.to_dict() == {
+            "a": [4, 3, 2, 1],
+            "b": ["w", "z", "y", "x"]
+        }
+
+    def test_view_does_not_share_context_with_different_config(self):
+        tbl = Table({"a": [1, 2, 3], "b": ["x", "y", "z"]})
+        view = tbl.view(sort=[["a", "desc"]])
+        view2 = tbl.view(sort=[["a", "asc"]])
+        assert len(tbl._table.get_gnode().get_registered_contexts()) == 2
+        assert view.to_dict() == {"a": [3, 2, 1], "b": ["z", "y", "x"]}
+        assert view2.to_dict() == {"a": [1, 2, 3], "b": ["x", "y", "z"]}
+
+    def test_view_does_not_share_context_with_close_float_filters(self):
+        tbl = Table({"a": [1.0, 1.00000015, 2.0]})
+        view = tbl.view(filter=[["a", ">", 1.0000001]])
+        view2 = tbl.view(filter=[["a", ">", 1.0000002]])
+        assert len(tbl._table.get_gnode().get_registered_contexts()) == 2
+        assert view.to_dict() == {"a": [1.00000015, 2.0]}
+        assert view2.to_dict() == {"a": [2.0]}
+
+    def test_view_does_not_share_context_with_different_datetime_filters(self):
+        tbl = Table({"a": [datetime(2020, 1, 1, 0, 0, 0, 1000), datetime(2020, 1, 1, 0, 0, 0, 2000)]})
+        view = tbl.view(filter=[["a", ">", datetime(2020, 1, 1)]])
+        view2 = tbl.view(filter=[["a", ">", datetime(2020, 1, 1, 0, 0, 0, 1000)]])
+        assert len(tbl._table.get_gnode().get_registered_contexts()) == 2
+        assert view.num_rows() == 2
+        assert view2.num_rows() == 1
+
+    def test_view_does_not_share_pivoted_context(self):
+        tbl = Table({"a": [1, 2, 3], "b": ["x", "y", "x"]})
+        view = tbl.view(row_pivots=["b"])
+        view2 = tbl.view(row_pivots=["b"])
+        assert len(tbl._table.get_gnode().get_registered_contexts()) == 2
+        view.collapse(0)
+        assert view.num_rows() == 1
+        assert view2.num_rows() == 3
+
+    def test_view_shared_context_outlives_first_view(self):
+        tbl = Table({"a": [1, 2, 3]})
+        view = tbl.view(sort=[["a", "desc"]])
+        view2 = tbl.view(sort=[["a", "desc"]])
+        gnode = tbl._table.get_gnode()
+
+        # the context stays registered under the first view's name
+        view.delete()
+        del view
+        assert len(gnode.get_registered_contexts()) == 1
+        tbl.update({"a": [4]})
+        assert view2.to_dict() == {"a": [4, 3, 2, 1]}
+
+        view2.delete()
+        del view2
+        assert len(gnode.get_registered_contexts()) == 0
+
     # hidden cols
 
     def test_view_num_hidden_cols(self):
@@ -7,7 +7,6 @@
 #
 
 from functools import partial
-import tornado.locks
 import tornado.websocket
 from tornado.gen import coroutine
 from tornado.ioloop import IOLoop
@@ -57,7 +56,16 @@ class PerspectiveTornadoHandler(tornado.websocket.WebSocketHandler):
         self._check_origin = kwargs.pop("check_origin", False)
         self._chunk_size = kwargs.pop("chunk_size", 25165824)
         self._session = self._manager.new_session()
-        self._stream_lock = tornado.locks.Lock()
+
+        # Messages wait in the session's queue until the previous message
+        # has been written, so a slow client only delays and sheds its own
+        # updates. The manager may post from other threads, so draining is
+        # always scheduled on this handler's loop.
+        self._loop = IOLoop.current()
+        self._queue = self._session.outbound_queue(
+            partial(self._loop.add_callback, self._drain)
+        )
+        self._draining = False
 
         # https://www.tornadoweb.org/en/stable/gen.html#tornado.gen.moment
         self._chunk_sleep = kwargs.pop("_chunk_sleep", 0)
@@ -91,34 +99,17 @@ class PerspectiveTornadoHandler(tornado.websocket.WebSocketHandler):
             self.write_message("pong")
             return
 
-        loop = IOLoop.current()
-        self._session.process(message, partial(loop.add_callback, self.post))
+        self._session.process(message, self._queue)
 
     def post(self, message, binary=False):
-        """When `post` is called by `PerspectiveManager`, serialize the data to
-        JSON and send it to the client.
+        """Queue a message, i.e. a JSON-serialized string containing a message
+        to the front-end `perspective-viewer`, to be sent to the client.
 
         Args:
             message (:obj:`str`): a JSON-serialized string containing a message to the
                 front-end `perspective-viewer`.
         """
-        loop = IOLoop.current()
-
-        # Only send message in chunks if it passes the threshold set by the
-        # `PerspectiveManager`.
-        chunked = len(message) > self._chunk_size
-
-        if binary and chunked:
-            loop.add_callback(
-                self._with_lock,
-                self._post_chunked,
-                message,
-                0,
-                self._chunk_size,
-                len(message),
-            )
-        else:
-            loop.add_callback(self._with_lock, self.write_message, message, binary)
+        self._queue(message, binary)
 
     def on_close(self):
         """Remove the views associated with the client when the websocket
@@ -127,18 +118,40 @@ class PerspectiveTornadoHandler(tornado.websocket.WebSocketHandler):
         self._session.close()
 
     @tornado.gen.coroutine
-    def _with_lock(self, f, *args, **kwargs):
-        """A python2-compatible, tornado-async-friendly lock wrapper which
-        serializes access of `f`, used to block responses from future messages
-        from interleaving binary streams.
+    def _drain(self):
+        """Write queued messages to the websocket, waiting for each write to
+        complete before starting the next. This serializes writes, so binary
+        streams are never interleaved with other messages.
         """
-        yield self._stream_lock.acquire()
+        if self._draining:
+            return
+
+        self._draining = True
         try:
-            yield f(*args, **kwargs)
+            while True:
+                frames = self._queue.pop()
+
+                if frames is None:
+                    break
+
+                for message, binary in frames:
+                    # Only send message in chunks if it passes the threshold
+                    # set by the `PerspectiveManager`.
+                    chunked = (
+                        self._chunk_size is not None
+                        and len(message) > self._chunk_size
+                    )
+
+                    if binary and chunked:
+                        yield self._post_chunked(
+                            message, 0, self._chunk_size, len(message)
+                        )
+                    else:
+                        yield self.write_message(message, binary)
         except tornado.websocket.WebSocketClosedError:
             pass
         finally:
-            yield self._stream_lock.release()
+            self._draining = False
 
     @coroutine
     def _post_chunked(self, message, start, end, message_length):